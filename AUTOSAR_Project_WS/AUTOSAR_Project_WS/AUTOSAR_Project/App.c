@@ -14,6 +14,9 @@
 #include "Led.h"
 #include "Dio.h"
 #include "Mcu.h"
+#include "Port.h"
+#include "Qdec.h"
+#include "Ocu.h"
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
@@ -21,9 +24,18 @@ void Init_Task(void)
     /* Initialize Mcu Driver */
     Mcu_Init();
 
+    /* Initialize Port Driver with the configuration set of the board variant */
+    Port_Init(Port_ConfigSets[Port_GetConfigSetId()]);
+
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
 
+    /* Initialize Quadrature Decoder, the phase pins are configured by Port_Init */
+    Qdec_Init();
+
+    /* Initialize Output Compare, starts the timebase before any event is scheduled */
+    Ocu_Init();
+
     /* Initialize LED Driver */
     Led_Init();
 
@@ -37,6 +49,18 @@ void Button_Task(void)
     Button_RefreshState();
 }
 
+/* Description: Task executes every 20 Mili-seconds to finish the Port init then check a slice of the GPIO registers */
+void Port_Task(void)
+{
+    /* Configure the deferred pins one port per call, then check the registers */
+    if (Port_InitContinue() == TRUE)
+    {
+#if (PORT_INTEGRITY_CHECK_API == STD_ON)
+        (void)Port_CheckIntegrity();
+#endif
+    }
+}
+
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void)
 {
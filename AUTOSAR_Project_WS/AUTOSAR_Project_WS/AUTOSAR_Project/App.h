@@ -23,6 +23,9 @@ void Button_Task(void);
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
+/* Description: Task executes every 20 Mili-seconds to finish the Port init then check a slice of the GPIO registers */
+void Port_Task(void);
+
 /* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
 void App_Task(void);
 
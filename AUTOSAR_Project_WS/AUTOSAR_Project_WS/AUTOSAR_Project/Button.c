@@ -30,13 +30,17 @@ static void Button_FillConfigurations(void)
     g_Button_Config.initial_value  = BUTTON_RELEASED;    /* Button is released */
     g_Button_Config.pin_dir_changeable = STD_OFF;    /* Button direction cannot be changed in runtime */
     g_Button_Config.pin_mode_changeable = STD_OFF;   /* Button mode cannot be changed (default mode GPIO) */
+    g_Button_Config.park      = PORT_PIN_PARK_NONE;      /* Button kept live in low power (wake-up) */
+    g_Button_Config.init_class = PORT_PIN_INIT_DEFERRED; /* Same class as in the configuration sets */
+    g_Button_Config.drive     = PORT_PIN_DRIVE_2MA;      /* Same drive as in the configuration sets */
+    g_Button_Config.open_drain = STD_OFF;                /* Push-pull, no open drain */
 }
 
 /*******************************************************************************************************************/
 void Button_Init(void)
 {
     Button_FillConfigurations();
-    Port_Init(&g_Button_Config);
+    Port_InitPins(&g_Button_Config, 1);
 }
 
 /*******************************************************************************************************************/
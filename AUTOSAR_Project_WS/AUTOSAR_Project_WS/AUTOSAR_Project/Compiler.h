@@ -51,4 +51,37 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/*
+ * Exclusive load/store of a 32-bit word (LDREX/STREX) used for the read-modify-write of
+ * registers without disabling the interrupts. STORE_EXCLUSIVE returns 0 when the word is
+ * stored, 1 when an exception (or another exclusive access) came after LOAD_EXCLUSIVE:
+ * the Cortex-M4 clears its local monitor on exception entry and return, so the sequence
+ * is restarted with the value written by the interrupt.
+ */
+#if defined(__TI_ARM__)
+#define LOAD_EXCLUSIVE(ADDR)             ((unsigned int)__ldrex((void *)(ADDR)))
+#define STORE_EXCLUSIVE(VALUE, ADDR)     ((unsigned int)__strex((unsigned int)(VALUE), (void *)(ADDR)))
+#elif defined(__GNUC__) && defined(__ARM_ARCH_7EM__)
+LOCAL_INLINE unsigned int Compiler_LoadExclusive(volatile unsigned int *Addr)
+{
+    unsigned int value;
+    __asm volatile ("ldrex %0, [%1]" : "=r" (value) : "r" (Addr) : "memory");
+    return value;
+}
+
+LOCAL_INLINE unsigned int Compiler_StoreExclusive(unsigned int Value, volatile unsigned int *Addr)
+{
+    unsigned int failed;
+    __asm volatile ("strex %0, %1, [%2]" : "=&r" (failed) : "r" (Value), "r" (Addr) : "memory");
+    return failed;
+}
+
+#define LOAD_EXCLUSIVE(ADDR)             Compiler_LoadExclusive((volatile unsigned int *)(ADDR))
+#define STORE_EXCLUSIVE(VALUE, ADDR)     Compiler_StoreExclusive((unsigned int)(VALUE), (volatile unsigned int *)(ADDR))
+#else
+/* Host builds (Tools) run without interrupts, a plain load and store */
+#define LOAD_EXCLUSIVE(ADDR)             ((unsigned int)*(ADDR))
+#define STORE_EXCLUSIVE(VALUE, ADDR)     ((*(ADDR) = (VALUE)), 0U)
+#endif
+
 #endif
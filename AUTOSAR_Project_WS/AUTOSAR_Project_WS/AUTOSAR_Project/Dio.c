@@ -27,6 +27,10 @@
 STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* GPIO register blocks of the ports indexed by the Port_Num member of the channels */
+STATIC Port_GpioRegsType * const Dio_GpioBlock[DIO_NUMBER_OF_PORTS] =
+        PORT_GPIO_BLOCK_TABLE;
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -73,7 +77,8 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	Port_GpioRegsType * Gpio_Ptr = NULL_PTR;
+	uint32 mask = 0;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -105,31 +110,18 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* GPIODATA of the port accessed through the address masked with the channel bit only */
+		Gpio_Ptr = Dio_GpioBlock[Dio_PortChannels[ChannelId].Port_Num];
+		mask = (uint32)1U << Dio_PortChannels[ChannelId].Ch_Num;
 		if(Level == STD_HIGH)
 		{
-			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			/* Write Logic High, the mask keeps the other channels untouched */
+			PORT_GPIO(Gpio_Ptr, DATA[mask]) = DIO_MASKED_DATA_ALL_HIGH;
 		}
 		else if(Level == STD_LOW)
 		{
-			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			/* Write Logic Low, the mask keeps the other channels untouched */
+			PORT_GPIO(Gpio_Ptr, DATA[mask]) = DIO_MASKED_DATA_ALL_LOW;
 		}
 	}
 	else
@@ -152,7 +144,8 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	Port_GpioRegsType * Gpio_Ptr = NULL_PTR;
+	uint32 mask = 0;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -185,24 +178,11 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+		/* GPIODATA of the port accessed through the address masked with the channel bit only */
+		Gpio_Ptr = Dio_GpioBlock[Dio_PortChannels[ChannelId].Port_Num];
+		mask = (uint32)1U << Dio_PortChannels[ChannelId].Ch_Num;
+		/* Read the required channel, the masked read returns zero for the other channels */
+		if(PORT_GPIO(Gpio_Ptr, DATA[mask]) != DIO_MASKED_DATA_ALL_LOW)
 		{
 			output = STD_HIGH;
 		}
@@ -271,7 +251,8 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	Port_GpioRegsType * Gpio_Ptr = NULL_PTR;
+	uint32 mask = 0;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -304,31 +285,18 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* GPIODATA of the port accessed through the address masked with the channel bit only */
+		Gpio_Ptr = Dio_GpioBlock[Dio_PortChannels[ChannelId].Port_Num];
+		mask = (uint32)1U << Dio_PortChannels[ChannelId].Ch_Num;
 		/* Read the required channel and write the required level */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+		if(PORT_GPIO(Gpio_Ptr, DATA[mask]) != DIO_MASKED_DATA_ALL_LOW)
 		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			PORT_GPIO(Gpio_Ptr, DATA[mask]) = DIO_MASKED_DATA_ALL_LOW;
 			output = STD_LOW;
 		}
 		else
 		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			PORT_GPIO(Gpio_Ptr, DATA[mask]) = DIO_MASKED_DATA_ALL_HIGH;
 			output = STD_HIGH;
 		}
 	}
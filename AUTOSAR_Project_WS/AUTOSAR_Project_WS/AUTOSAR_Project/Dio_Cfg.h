@@ -26,8 +26,11 @@
 #define DIO_CFG_AR_RELEASE_MINOR_VERSION     (0U)
 #define DIO_CFG_AR_RELEASE_PATCH_VERSION     (3U)
 
-/* Pre-compile option for Development Error Detect */
+/* Pre-compile option for Development Error Detect, can also be set from the build
+ * command line (-DDIO_DEV_ERROR_DETECT=STD_OFF) as done by Tools/DioBench */
+#ifndef DIO_DEV_ERROR_DETECT
 #define DIO_DEV_ERROR_DETECT                (STD_ON)
+#endif
 
 /* Pre-compile option for Version Info API */
 #define DIO_VERSION_INFO_API                (STD_OFF)
@@ -36,18 +39,24 @@
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
 /* Number of the configured Dio Channels */
-#define DIO_CONFIGURED_CHANNLES              (2U)
+#define DIO_CONFIGURED_CHANNLES              (4U)
 
 /* Channel Index in the array of structures in Dio_PBcfg.c */
 #define DioConf_LED1_CHANNEL_ID_INDEX        (uint8)0x00
 #define DioConf_SW1_CHANNEL_ID_INDEX         (uint8)0x01
+#define DioConf_ENCA_CHANNEL_ID_INDEX        (uint8)0x02
+#define DioConf_ENCB_CHANNEL_ID_INDEX        (uint8)0x03
 
 /* DIO Configured Port ID's  */
 #define DioConf_LED1_PORT_NUM                (Dio_PortType)5 /* PORTF */
 #define DioConf_SW1_PORT_NUM                 (Dio_PortType)5 /* PORTF */
+#define DioConf_ENCA_PORT_NUM                (Dio_PortType)3 /* PORTD */
+#define DioConf_ENCB_PORT_NUM                (Dio_PortType)3 /* PORTD */
 
 /* DIO Configured Channel ID's */
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
+#define DioConf_ENCA_CHANNEL_NUM             (Dio_ChannelType)2 /* Pin 2 in PORTD */
+#define DioConf_ENCB_CHANNEL_NUM             (Dio_ChannelType)3 /* Pin 3 in PORTD */
 
 #endif /* DIO_CFG_H */
@@ -42,5 +42,7 @@
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
                                              DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				                             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+				                             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM,
+				                             DioConf_ENCA_PORT_NUM,DioConf_ENCA_CHANNEL_NUM,
+				                             DioConf_ENCB_PORT_NUM,DioConf_ENCB_CHANNEL_NUM
 				                         };
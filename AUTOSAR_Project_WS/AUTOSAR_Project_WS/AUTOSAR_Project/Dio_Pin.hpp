@@ -0,0 +1,216 @@
+ /******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio_Pin.hpp
+ *
+ * Description: Header-only C++ typed pin layer for TM4C123GH6PM Microcontroller.
+ *              Every Pin<PortX, N> access resolves at compile time to a single
+ *              access on the GPIODATA address masked with the pin bit.
+ *              The C Dio/Port APIs are not affected by this file.
+ *
+ *              setMode() and setDirection() write the Port registers directly and
+ *              do not update the shadow of the Port Driver: do not use them on
+ *              pins checked by Port_CheckIntegrity (PORT_INTEGRITY_CHECK_API), the
+ *              change would be reported as a corruption and, with
+ *              PORT_INTEGRITY_REPAIR, reverted. Use Port_SetPinMode and
+ *              Port_SetPinDirection for those pins.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef DIO_PIN_HPP
+#define DIO_PIN_HPP
+
+#include "Std_Types.h"
+#include "Port_Types.h"
+#include "Port_Cfg.h"
+#include "Port_Reg.h"
+#include "Dio.h"
+#include "Dio_Regs.h"
+
+namespace Dio
+{
+
+/* Target HW ports usable as Pin template arguments */
+constexpr Port_PortType PortA = PORT_PortA;
+constexpr Port_PortType PortB = PORT_PortB;
+constexpr Port_PortType PortC = PORT_PortC;
+constexpr Port_PortType PortD = PORT_PortD;
+constexpr Port_PortType PortE = PORT_PortE;
+constexpr Port_PortType PortF = PORT_PortF;
+
+/* Number of ports in the target HW */
+constexpr Port_PortType NumberOfPorts = PORT_NUMBER_OF_PORTS;
+
+/* Description: Base address of a port */
+constexpr uint32 portBase(Port_PortType Port)
+{
+    return (Port == PortA) ? GPIO_PORTA_BASE_ADDRESS :
+           (Port == PortB) ? GPIO_PORTB_BASE_ADDRESS :
+           (Port == PortC) ? GPIO_PORTC_BASE_ADDRESS :
+           (Port == PortD) ? GPIO_PORTD_BASE_ADDRESS :
+           (Port == PortE) ? GPIO_PORTE_BASE_ADDRESS :
+                             GPIO_PORTF_BASE_ADDRESS;
+}
+
+/* Description: Number of pins bonded out in a port (PORTE has 6 pins, PORTF has 5 pins) */
+constexpr Port_PinType pinsInPort(Port_PortType Port)
+{
+    return (Port == PortE) ? 6U : (Port == PortF) ? 5U : 8U;
+}
+
+/* Allowed-mode bitmaps of the target HW pins */
+constexpr uint32 AllowedModes[NumberOfPorts][PORT_NUMBER_OF_PINS_PER_PORT] = PORT_ALLOWED_MODES_TABLE;
+
+/* Description: True if the mode is allowed for the pin */
+constexpr bool isModeAllowed(Port_PortType Port, Port_PinType PinNum, Port_PinModeType Mode)
+{
+    return (AllowedModes[Port][PinNum] & PORT_MODE_BIT(Mode)) != 0U;
+}
+
+/* Description: True for the pins protected by the GPIOLOCK/GPIOCR commit mechanism (PD7, PF0) */
+constexpr bool isCommitProtected(Port_PortType Port, Port_PinType PinNum)
+{
+    return PORT_PIN_IS_LOCKED(Port, PinNum);
+}
+
+/* Description: True for the pins the Port Driver never configures (JTAG, PD7/PF0 when not unlocked) */
+constexpr bool isReserved(Port_PortType Port, Port_PinType PinNum)
+{
+    return PORT_PIN_IS_RESERVED(Port, PinNum);
+}
+
+/*
+ * Description: Compile-time checked GPIO pin.
+ *  - write()/read()/toggle() use the GPIODATA address masked with the pin bit,
+ *    so write() is one store and read() is one load, the same code as a
+ *    hand-written masked register access.
+ *  - setMode<Mode>() and setDirection() configure the pin through the Port
+ *    registers, the requested mode is checked against the target HW table
+ *    and PD7/PF0 can only be configured when PORT_UNLOCK_LOCKED_PINS is on.
+ */
+template <Port_PortType Port, Port_PinType PinNum>
+class Pin
+{
+    static_assert(Port < NumberOfPorts, "Invalid port, the target HW has ports A-F");
+    static_assert(PinNum < pinsInPort(Port), "Invalid pin, the pin does not exist in this port");
+    static_assert(AllowedModes[Port][PinNum] != 0U, "PC0-PC3 are JTAG pins and cannot be used");
+
+public:
+    /* Bit of the pin inside its port registers */
+    static constexpr uint32 Mask = (uint32)1U << PinNum;
+
+    /* Description: Write the pin level (STD_HIGH/STD_LOW) with a single store */
+    static inline void write(Dio_LevelType Level)
+    {
+        data() = (uint32)Level << PinNum;
+    }
+
+    /* Description: Drive the pin high with a single store */
+    static inline void set(void)
+    {
+        data() = DIO_MASKED_DATA_ALL_HIGH;
+    }
+
+    /* Description: Drive the pin low with a single store */
+    static inline void clear(void)
+    {
+        data() = DIO_MASKED_DATA_ALL_LOW;
+    }
+
+    /* Description: Read the pin level with a single load */
+    static inline Dio_LevelType read(void)
+    {
+        return (Dio_LevelType)(data() >> PinNum);
+    }
+
+    /* Description: Invert the pin level, one load and one store on the masked address */
+    static inline void toggle(void)
+    {
+        data() = ~data();
+    }
+
+    /* Description: Set the pin direction (GPIODIR is not commit protected) */
+    static inline void setDirection(Port_PinDirectionType Direction)
+    {
+        uint32 dir = gpio().DIR;
+
+        if (Direction == PORT_PIN_OUT)
+        {
+            gpio().DIR = dir | Mask;
+        }
+        else
+        {
+            gpio().DIR = dir & ~Mask;
+        }
+    }
+
+    /* Description: Set the pin mode, rejected at compile time if the target HW does not allow it.
+     *              Each register is read then written once (no compound assignment on volatile). */
+    template <Port_PinModeType Mode>
+    static inline void setMode(void)
+    {
+        static_assert(isModeAllowed(Port, PinNum, Mode), "This mode cannot be selected for this pin");
+        static_assert(!isReserved(Port, PinNum), "PD7/PF0 are locked, PORT_UNLOCK_LOCKED_PINS is STD_OFF");
+
+        const uint32 pctl_mask = (uint32)0x0000000F << (PinNum * 4U);
+        uint32 value = 0;
+
+        if (isCommitProtected(Port, PinNum))
+        {
+            /* Unlock the GPIOCR register and allow changes on this pin */
+            gpio().LOCK = PORT_GPIO_LOCK_KEY;
+            value = gpio().CR;
+            gpio().CR = value | Mask;
+        }
+
+        if (Mode == ANALOG)
+        {
+            value = gpio().DEN;
+            gpio().DEN = value & ~Mask;
+            value = gpio().AFSEL;
+            gpio().AFSEL = value & ~Mask;
+            value = gpio().PCTL;
+            gpio().PCTL = value & ~pctl_mask;
+            value = gpio().AMSEL;
+            gpio().AMSEL = value | Mask;
+        }
+        else
+        {
+            value = gpio().AMSEL;
+            gpio().AMSEL = value & ~Mask;
+            value = gpio().PCTL;
+            gpio().PCTL = (value & ~pctl_mask) | (((uint32)Mode & 0x0000000F) << (PinNum * 4U));
+            value = gpio().AFSEL;
+            gpio().AFSEL = (Mode == GPIO_MODE) ? (value & ~Mask) : (value | Mask);
+            value = gpio().DEN;
+            gpio().DEN = value | Mask;
+        }
+
+        if (isCommitProtected(Port, PinNum))
+        {
+            /* Clear the commit bit while GPIOCR is unlocked and relock it, the pin is protected again */
+            value = gpio().CR;
+            gpio().CR = value & ~Mask;
+            gpio().LOCK = PORT_GPIO_RELOCK_VALUE;
+        }
+    }
+
+private:
+    /* Description: Masked GPIODATA register of the pin */
+    static inline volatile uint32 & data(void)
+    {
+        return gpio().DATA[Mask];
+    }
+
+    /* Description: GPIO register block of the port */
+    static inline Port_GpioRegsType & gpio(void)
+    {
+        return *reinterpret_cast<Port_GpioRegsType *>(portBase(Port));
+    }
+};
+
+} /* namespace Dio */
+
+#endif /* DIO_PIN_HPP */
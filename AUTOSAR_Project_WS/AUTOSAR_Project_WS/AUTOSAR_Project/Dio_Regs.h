@@ -14,11 +14,18 @@
 
 #include "Std_Types.h"
 
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
+/* GPIO register block overlay shared with the Port Driver */
+#include "Port_Reg.h"
+
+/* Number of GPIO ports in the target HW (A-F) */
+#define DIO_NUMBER_OF_PORTS       (6U)
+
+/*
+ * Values written through a masked GPIODATA address (DATA[MASK] of the register block):
+ * address bits [9:2] select the pins affected, so a read returns only the masked pins
+ * and a write changes only the masked pins without a read-modify-write.
+ */
+#define DIO_MASKED_DATA_ALL_HIGH  (0xFFU)
+#define DIO_MASKED_DATA_ALL_LOW   (0x00U)
 
 #endif /* DIO_REGS_H */
@@ -8,32 +8,15 @@
  *
  * Author: Yousouf Soliman
  ******************************************************************************/
-#include "Port.h"
 #include "Dio.h"
 #include "Led.h"
 
-/* LED Configurations Structure */
-static Port_ConfigPin  g_LED_Config;
-
-/*********************************************************************************************/
-/* Description: Called by the LED_Init function (only) used to fill the led configurations structure */
-static void Led_FillConfigurations(void)
-{
-    g_LED_Config.port_num  = LED_PORT;        /* Set LED Port value */
-    g_LED_Config.pin_num   = LED_PIN_NUM;     /* Set LED PIN Number value */
-    g_LED_Config.direction = PORT_PIN_OUT;          /* Set LED as OUTPUT pin */
-    g_LED_Config.resistor  = OFF;     /* Disable internal resistor */
-    g_LED_Config.mode  = GPIO_MODE;  /* Set mode to DIO (GPIO) */
-    g_LED_Config.initial_value  = LED_OFF;    /* Turn Off the LED */
-    g_LED_Config.pin_dir_changeable = STD_OFF;  /* Button direction cannot be changed in runtime */
-    g_LED_Config.pin_mode_changeable = STD_OFF; /* Button mode cannot be changed (default mode GPIO) */
-}
-
 /*********************************************************************************************/
 void Led_Init(void)
 {
-    Led_FillConfigurations();
-    Port_Init(&g_LED_Config);
+    /* The LED pin is configured by Port_Init (critical pin of every configuration set)
+     * with the drive of the board, only its initial value is set here */
+    Led_SetOff();
 }
 
 /*********************************************************************************************/
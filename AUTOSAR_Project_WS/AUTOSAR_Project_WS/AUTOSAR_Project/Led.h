@@ -14,10 +14,7 @@
 #include "Std_Types.h"
 #include "Led_Cfg.h"
 
-/* Description: 1. Fill the led configurations structure 
- *              2. Set the PIN direction which the led is connected as OUTPUT pin
- *		        3. Initialize the led ON/OFF according to the initial value
- */
+/* Description: Initialize the led OFF, the led pin is configured by Port_Init */
 void Led_Init(void);
 
 /* Description: Set the LED state to ON */
@@ -16,10 +16,4 @@
 #define LED_ON  STD_HIGH
 #define LED_OFF STD_LOW
 
-/* Set the LED Port */
-#define LED_PORT DioConf_LED1_PORT_NUM
-
-/* Set the LED Pin Number */
-#define LED_PIN_NUM DioConf_LED1_CHANNEL_NUM
-
 #endif /* LED_CFG_H_ */
@@ -9,11 +9,10 @@
  * Author: Yousouf Soliman
  ******************************************************************************/
 
-#include "tm4c123gh6pm_registers.h"
+#include "Mcu.h"
 
 void Mcu_Init(void)
 {
-    /* Enable clock for All PORTs and wait for clock to start */
-    SYSCTL_RCGCGPIO_REG |= 0x3F;
-    while(!(SYSCTL_PRGPIO_REG & 0x3F));
+    /* The GPIO ports clocks are enabled by Port_Init for the ports used by
+     * the configuration only, the unused ports stay clock-gated */
 }
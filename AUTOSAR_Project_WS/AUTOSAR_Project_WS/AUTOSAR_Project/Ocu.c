@@ -0,0 +1,306 @@
+/******************************************************************************
+ *
+ * Module: Ocu
+ *
+ * File Name: Ocu.c
+ *
+ * Description: Source file for Software Output Compare Module.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include "Ocu.h"
+#include "Ocu_Regs.h"
+#include "Dio_Regs.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (OCU_DEV_ERROR_DETECT == STD_ON)
+#include "Det.h"
+#endif
+
+/* Current value of the free-running timebase */
+#define OCU_NOW()                   OCU_TIMER_REG(OCU_TIMEBASE_BASE_ADDRESS, OCU_TIMER_TAV_REG_OFFSET)
+
+/* Minimum load of the one-shot timer, an event already due fires on the next tick */
+#define OCU_MIN_ARM_TICKS           (1)
+
+/* NVIC enable/disable bit of the event timer interrupt */
+#define OCU_EVENT_TIMER_IRQ_BIT     (1UL << OCU_EVENT_TIMER_IRQ_NUM)
+
+/* Mask the event timer interrupt around the queue updates done by the tasks, then restore
+ * its previous state: writing 0 in NVIC_EN0 has no effect, so a disabled interrupt stays
+ * disabled */
+#define OCU_ENTER_CRITICAL(STATE) \
+    do { (STATE) = NVIC_EN0_REG & OCU_EVENT_TIMER_IRQ_BIT; NVIC_DIS0_REG = OCU_EVENT_TIMER_IRQ_BIT; } while (0)
+#define OCU_EXIT_CRITICAL(STATE)    (NVIC_EN0_REG = (STATE))
+
+/* Description: Pins written together at one timestamp, per port set and clear masks */
+typedef struct
+{
+    Ocu_TimeType Time;
+    uint8 SetMask[DIO_NUMBER_OF_PORTS];
+    uint8 ClearMask[DIO_NUMBER_OF_PORTS];
+} Ocu_BatchType;
+
+/* GPIO register blocks of the ports indexed by the Port_Num member of the channels */
+STATIC Port_GpioRegsType * const Ocu_GpioBlock[DIO_NUMBER_OF_PORTS] =
+        PORT_GPIO_BLOCK_TABLE;
+
+/* Set by Ocu_Init, the timers are clock gated before */
+STATIC uint8 Ocu_Status = OCU_NOT_INITIALIZED;
+
+/*
+ * Queue of the pending batches sorted by timestamp, the latest first, so that
+ * the next batch is always Ocu_Queue[Ocu_Count - 1] and the ISR pops it by
+ * decrementing the count only.
+ */
+STATIC Ocu_BatchType Ocu_Queue[OCU_MAX_EVENTS];
+STATIC volatile uint8 Ocu_Count = 0;
+
+/* Achieved timing of the written batches */
+STATIC volatile Ocu_JitterType Ocu_Jitter = {0, 0, 0, 0};
+
+/************************************************************************************/
+/* Description: Load the one-shot timer to expire OCU_ISR_LEAD_TICKS before the next batch */
+STATIC void Ocu_Arm(void)
+{
+    sint32 delay;
+
+    OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_CTL_REG_OFFSET) = 0;
+
+    if(Ocu_Count != 0U)
+    {
+        delay = (sint32)(Ocu_Queue[Ocu_Count - 1U].Time - OCU_NOW()) - (sint32)OCU_ISR_LEAD_TICKS;
+        if(delay < OCU_MIN_ARM_TICKS)
+        {
+            delay = OCU_MIN_ARM_TICKS;
+        }
+        OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_TAILR_REG_OFFSET) = (uint32)delay;
+        OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_CTL_REG_OFFSET)   =
+                OCU_TIMER_CTL_TAEN | OCU_TIMER_CTL_TASTALL;
+    }
+}
+
+/************************************************************************************/
+/* Description: Write all the pins of a batch, one masked GPIODATA store per port */
+STATIC void Ocu_WriteBatch(const Ocu_BatchType * Batch)
+{
+    uint8 port;
+    uint8 mask;
+
+    for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+    {
+        mask = Batch->SetMask[port] | Batch->ClearMask[port];
+        if(mask != 0U)
+        {
+            PORT_GPIO(Ocu_GpioBlock[port], DATA[mask]) = Batch->SetMask[port];
+        }
+    }
+}
+
+/************************************************************************************/
+void Ocu_Init(void)
+{
+    /* Enable clock for Timer 0 and Timer 1 and wait for clock to start */
+    SYSCTL_RCGCTIMER_REG |= OCU_TIMERS_CLOCK_MASK;
+    while((SYSCTL_PRTIMER_REG & OCU_TIMERS_CLOCK_MASK) != OCU_TIMERS_CLOCK_MASK);
+
+    /* Timebase: 32-bit periodic up-counter over the full range */
+    OCU_TIMER_REG(OCU_TIMEBASE_BASE_ADDRESS, OCU_TIMER_CTL_REG_OFFSET)   = 0;
+    OCU_TIMER_REG(OCU_TIMEBASE_BASE_ADDRESS, OCU_TIMER_CFG_REG_OFFSET)   = OCU_TIMER_CFG_32_BIT;
+    OCU_TIMER_REG(OCU_TIMEBASE_BASE_ADDRESS, OCU_TIMER_TAMR_REG_OFFSET)  =
+            OCU_TIMER_TAMR_PERIODIC | OCU_TIMER_TAMR_COUNT_UP;
+    OCU_TIMER_REG(OCU_TIMEBASE_BASE_ADDRESS, OCU_TIMER_TAILR_REG_OFFSET) = 0xFFFFFFFFU;
+    OCU_TIMER_REG(OCU_TIMEBASE_BASE_ADDRESS, OCU_TIMER_CTL_REG_OFFSET)   =
+            OCU_TIMER_CTL_TAEN | OCU_TIMER_CTL_TASTALL;
+
+    /* Event timer: 32-bit one-shot down-counter, loaded and enabled by Ocu_Arm */
+    OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_CTL_REG_OFFSET)  = 0;
+    OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_CFG_REG_OFFSET)  = OCU_TIMER_CFG_32_BIT;
+    OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_TAMR_REG_OFFSET) = OCU_TIMER_TAMR_ONE_SHOT;
+    OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_ICR_REG_OFFSET)  = OCU_TIMER_INT_TATO;
+    OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_IMR_REG_OFFSET)  = OCU_TIMER_INT_TATO;
+
+    Ocu_Count = 0;
+    Ocu_ResetJitter();
+    Ocu_Status = OCU_INITIALIZED;
+
+    /* Enable the event timer interrupt in the NVIC */
+    NVIC_EN0_REG = OCU_EVENT_TIMER_IRQ_BIT;
+}
+
+/************************************************************************************/
+Ocu_TimeType Ocu_GetTime(void)
+{
+    return OCU_NOW();
+}
+
+/************************************************************************************/
+Std_ReturnType Ocu_ScheduleEvent(Dio_ChannelType ChannelId, Dio_LevelType Level, Ocu_TimeType Time)
+{
+    const Dio_ConfigChannel * Channel = NULL_PTR;
+    Ocu_BatchType * Batch = NULL_PTR;
+    Std_ReturnType ret = E_OK;
+    uint8 bit;
+    uint8 port;
+    uint8 index;
+    uint8 pos;
+    uint32 irq_state;
+
+    /* The timers are clock gated before Ocu_Init, arming the event timer would fault */
+    if(Ocu_Status == OCU_NOT_INITIALIZED)
+    {
+#if (OCU_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(OCU_MODULE_ID, OCU_INSTANCE_ID, OCU_SCHEDULE_EVENT_SID, OCU_E_UNINIT);
+#endif
+        return E_NOT_OK;
+    }
+
+    if(ChannelId >= DIO_CONFIGURED_CHANNLES)
+    {
+        return E_NOT_OK;
+    }
+
+    Channel = &Dio_Configuration.Channels[ChannelId];
+    port = Channel->Port_Num;
+    bit  = (uint8)(1U << Channel->Ch_Num);
+
+    OCU_ENTER_CRITICAL(irq_state);
+
+    /* Look for a queued batch close enough to carry this event */
+    for(index = 0; index < Ocu_Count; index++)
+    {
+        sint32 distance = (sint32)(Time - Ocu_Queue[index].Time);
+        if((distance <= (sint32)OCU_MERGE_WINDOW_TICKS) && (distance >= -(sint32)OCU_MERGE_WINDOW_TICKS))
+        {
+            Batch = &Ocu_Queue[index];
+            Ocu_Jitter.Merged++;
+            break;
+        }
+    }
+
+    if(Batch == NULL_PTR)
+    {
+        if(Ocu_Count >= OCU_MAX_EVENTS)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /* Shift the earlier batches up and insert the new batch behind the later ones */
+            pos = Ocu_Count;
+            while((pos > 0U) && ((sint32)(Ocu_Queue[pos - 1U].Time - Time) < 0))
+            {
+                Ocu_Queue[pos] = Ocu_Queue[pos - 1U];
+                pos--;
+            }
+            Batch = &Ocu_Queue[pos];
+            Batch->Time = Time;
+            for(index = 0; index < DIO_NUMBER_OF_PORTS; index++)
+            {
+                Batch->SetMask[index]   = 0;
+                Batch->ClearMask[index] = 0;
+            }
+            Ocu_Count++;
+        }
+    }
+
+    if(Batch != NULL_PTR)
+    {
+        /* A later event on the same pin of the batch overrides the earlier one */
+        if(Level == STD_HIGH)
+        {
+            Batch->SetMask[port]   |= bit;
+            Batch->ClearMask[port] &= (uint8)~bit;
+        }
+        else
+        {
+            Batch->ClearMask[port] |= bit;
+            Batch->SetMask[port]   &= (uint8)~bit;
+        }
+
+        /* The new batch is the next one to write */
+        if(Batch == &Ocu_Queue[Ocu_Count - 1U])
+        {
+            Ocu_Arm();
+        }
+    }
+
+    OCU_EXIT_CRITICAL(irq_state);
+
+    return ret;
+}
+
+/************************************************************************************/
+void Ocu_TimerHandler(void)
+{
+    const Ocu_BatchType * Batch = NULL_PTR;
+    Ocu_TimeType now;
+    uint32 lateness;
+
+    OCU_TIMER_REG(OCU_EVENT_TIMER_BASE_ADDRESS, OCU_TIMER_ICR_REG_OFFSET) = OCU_TIMER_INT_TATO;
+
+    /* Write every batch due within the lead time, then arm the timer for the next one */
+    while((Ocu_Count != 0U)
+            && ((sint32)(Ocu_Queue[Ocu_Count - 1U].Time - OCU_NOW()) <= (sint32)OCU_ISR_LEAD_TICKS))
+    {
+        Batch = &Ocu_Queue[Ocu_Count - 1U];
+
+        /* Wait for the exact tick, bounded by OCU_ISR_LEAD_TICKS */
+        do
+        {
+            now = OCU_NOW();
+        } while((sint32)(Batch->Time - now) > 0);
+
+        Ocu_WriteBatch(Batch);
+
+        /* Lateness when the last port is written, the stores of the batch are included */
+        now = OCU_NOW();
+        lateness = now - Batch->Time;
+        Ocu_Jitter.LastLateness = lateness;
+        if(lateness > Ocu_Jitter.MaxLateness)
+        {
+            Ocu_Jitter.MaxLateness = lateness;
+        }
+        Ocu_Jitter.Batches++;
+
+        Ocu_Count--;
+    }
+
+    Ocu_Arm();
+}
+
+/************************************************************************************/
+void Ocu_GetJitter(Ocu_JitterType * JitterPtr)
+{
+    uint32 irq_state;
+
+    if(Ocu_Status == OCU_NOT_INITIALIZED)
+    {
+#if (OCU_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(OCU_MODULE_ID, OCU_INSTANCE_ID, OCU_GET_JITTER_SID, OCU_E_UNINIT);
+#endif
+    }
+    else if(JitterPtr != NULL_PTR)
+    {
+        OCU_ENTER_CRITICAL(irq_state);
+        JitterPtr->LastLateness = Ocu_Jitter.LastLateness;
+        JitterPtr->MaxLateness  = Ocu_Jitter.MaxLateness;
+        JitterPtr->Batches      = Ocu_Jitter.Batches;
+        JitterPtr->Merged       = Ocu_Jitter.Merged;
+        OCU_EXIT_CRITICAL(irq_state);
+    }
+}
+
+/************************************************************************************/
+void Ocu_ResetJitter(void)
+{
+    uint32 irq_state;
+
+    OCU_ENTER_CRITICAL(irq_state);
+    Ocu_Jitter.LastLateness = 0;
+    Ocu_Jitter.MaxLateness  = 0;
+    Ocu_Jitter.Batches      = 0;
+    Ocu_Jitter.Merged       = 0;
+    OCU_EXIT_CRITICAL(irq_state);
+}
@@ -0,0 +1,146 @@
+/******************************************************************************
+ *
+ * Module: Ocu
+ *
+ * File Name: Ocu.h
+ *
+ * Description: Header file for Software Output Compare Module.
+ *              Schedules Dio channel writes at absolute timestamps of a
+ *              free-running 32-bit timebase.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef OCU_H
+#define OCU_H
+
+/* Ocu Module Id */
+#define OCU_MODULE_ID    (125U)
+
+/* Ocu Instance Id */
+#define OCU_INSTANCE_ID  (0U)
+
+/*
+ * Macros for Ocu Status
+ */
+#define OCU_INITIALIZED                (1U)
+#define OCU_NOT_INITIALIZED            (0U)
+
+#include "Std_Types.h"
+#include "Dio.h"
+#include "Ocu_Cfg.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Ocu Schedule Event */
+#define OCU_SCHEDULE_EVENT_SID         (uint8)0x01
+
+/* Service ID for Ocu Get Jitter */
+#define OCU_GET_JITTER_SID             (uint8)0x02
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service used before Ocu_Init */
+#define OCU_E_UNINIT                   (uint8)0x02
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Timestamp in timebase ticks, wraps every 2^32 ticks (~268s at 16Mhz) */
+typedef uint32 Ocu_TimeType;
+
+/* Description: Achieved timing of the fired events */
+typedef struct
+{
+    uint32 LastLateness;  /* Ticks between the scheduled time and the end of the write of the last batch */
+    uint32 MaxLateness;   /* Worst lateness since Ocu_Init or the last Ocu_ResetJitter */
+    uint32 Batches;       /* Number of batches written */
+    uint32 Merged;        /* Number of events merged into an already queued batch */
+} Ocu_JitterType;
+
+/* Convert a delay in micro-seconds to timebase ticks */
+#define OCU_US_TO_TICKS(US)             ((Ocu_TimeType)(US) * OCU_TICKS_PER_US)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Ocu_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the free-running timebase (Timer 0), configure the
+*              one-shot event timer (Timer 1 A), clear the queue and the jitter.
+************************************************************************************/
+void Ocu_Init(void);
+
+/************************************************************************************
+* Service Name: Ocu_GetTime
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Ocu_TimeType - Current timebase value
+* Description: Function to read the timebase, used to build event timestamps
+*              e.g. Ocu_GetTime() + OCU_US_TO_TICKS(350).
+************************************************************************************/
+Ocu_TimeType Ocu_GetTime(void);
+
+/************************************************************************************
+* Service Name: Ocu_ScheduleEvent
+* Sync/Async: Asynchronous
+* Reentrancy: non-reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Level - Value to be written.
+*                  Time - Absolute timestamp of the write, less than 2^31 ticks ahead.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the event is queued,
+*                                E_NOT_OK if the module is not initialized, the channel
+*                                is invalid or the queue is full.
+* Description: Function to queue a channel write at a timestamp. An event within
+*              OCU_MERGE_WINDOW_TICKS of a queued batch joins that batch.
+*              A timestamp already passed is written as soon as possible.
+************************************************************************************/
+Std_ReturnType Ocu_ScheduleEvent(Dio_ChannelType ChannelId, Dio_LevelType Level, Ocu_TimeType Time);
+
+/************************************************************************************
+* Service Name: Ocu_TimerHandler
+* Description: Timer 1 A ISR, writes the due batches and arms the next one.
+************************************************************************************/
+void Ocu_TimerHandler(void);
+
+/************************************************************************************
+* Service Name: Ocu_GetJitter
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): JitterPtr - Achieved timing of the fired events
+* Return value: None
+* Description: Function to get the achieved lateness of the written batches, measured
+*              when the last port of each batch has been written.
+************************************************************************************/
+void Ocu_GetJitter(Ocu_JitterType * JitterPtr);
+
+/************************************************************************************
+* Service Name: Ocu_ResetJitter
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the jitter statistics.
+************************************************************************************/
+void Ocu_ResetJitter(void);
+
+#endif /* OCU_H */
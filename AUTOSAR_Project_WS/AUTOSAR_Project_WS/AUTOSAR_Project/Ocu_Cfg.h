@@ -0,0 +1,38 @@
+/******************************************************************************
+ *
+ * Module: Ocu
+ *
+ * File Name: Ocu_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Ocu Module
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef OCU_CFG_H_
+#define OCU_CFG_H_
+
+/* Enable/Disable the Det reports of the calls made before Ocu_Init */
+#define OCU_DEV_ERROR_DETECT            (STD_ON)
+
+/* Timer clock frequency in MHz (system clock 16Mhz), one tick is 62.5ns */
+#define OCU_TICKS_PER_US                (16U)
+
+/* Maximum number of pending event batches in the queue */
+#define OCU_MAX_EVENTS                  (8U)
+
+/*
+ * Events whose timestamps are at most this number of ticks apart are merged
+ * into one batch and written together at the time of the queued batch.
+ * 0 merges only the events scheduled on the same tick.
+ */
+#define OCU_MERGE_WINDOW_TICKS          (0U)
+
+/*
+ * The one-shot timer expires this number of ticks before the event time to
+ * cover the interrupt entry, the ISR then waits on the timebase until the
+ * exact tick before writing the pins.
+ */
+#define OCU_ISR_LEAD_TICKS              (48U)
+
+#endif /* OCU_CFG_H_ */
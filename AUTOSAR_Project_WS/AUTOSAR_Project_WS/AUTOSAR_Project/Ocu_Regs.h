@@ -0,0 +1,54 @@
+/******************************************************************************
+ *
+ * Module: Ocu
+ *
+ * File Name: Ocu_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Ocu Module Registers
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef OCU_REGS_H
+#define OCU_REGS_H
+
+#include "Std_Types.h"
+
+/* Timer 0 is the free-running timebase, Timer 1 A is the one-shot event timer */
+#define OCU_TIMEBASE_BASE_ADDRESS       (0x40030000U)
+#define OCU_EVENT_TIMER_BASE_ADDRESS    (0x40031000U)
+
+/* General-Purpose Timer registers offsets */
+#define OCU_TIMER_CFG_REG_OFFSET        (0x000U)
+#define OCU_TIMER_TAMR_REG_OFFSET       (0x004U)
+#define OCU_TIMER_CTL_REG_OFFSET        (0x00CU)
+#define OCU_TIMER_IMR_REG_OFFSET        (0x018U)
+#define OCU_TIMER_ICR_REG_OFFSET        (0x024U)
+#define OCU_TIMER_TAILR_REG_OFFSET      (0x028U)
+#define OCU_TIMER_TAV_REG_OFFSET        (0x050U)
+
+#define OCU_TIMER_REG(BASE, OFFSET) \
+    (*((volatile uint32 *)((uint32)(BASE) + (uint32)(OFFSET))))
+
+/* GPTMCFG: 32-bit timer configuration */
+#define OCU_TIMER_CFG_32_BIT            (0x00U)
+
+/* GPTMTAMR: one-shot / periodic mode and count up direction */
+#define OCU_TIMER_TAMR_ONE_SHOT         (0x01U)
+#define OCU_TIMER_TAMR_PERIODIC         (0x02U)
+#define OCU_TIMER_TAMR_COUNT_UP         (0x10U)
+
+/* GPTMCTL: timer enable and stall while the debugger halts the core */
+#define OCU_TIMER_CTL_TAEN              (0x01U)
+#define OCU_TIMER_CTL_TASTALL           (0x02U)
+
+/* GPTMIMR/GPTMICR: timer A time-out interrupt */
+#define OCU_TIMER_INT_TATO              (0x01U)
+
+/* RCGCTIMER/PRTIMER bits of the used timers */
+#define OCU_TIMERS_CLOCK_MASK           (0x03U)
+
+/* NVIC interrupt number of Timer 1 A */
+#define OCU_EVENT_TIMER_IRQ_NUM         (21U)
+
+#endif /* OCU_REGS_H */
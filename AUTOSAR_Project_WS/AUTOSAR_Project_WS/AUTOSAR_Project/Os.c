@@ -78,21 +78,25 @@ void Os_Scheduler(void)
 		case 20:
 		case 100:
 			    Button_Task();
+			    Port_Task();
 			    g_New_Time_Tick_Flag = 0;
 			    break;
 		case 40:
 		case 80:
 			    Button_Task();
+			    Port_Task();
 			    Led_Task();
 			    g_New_Time_Tick_Flag = 0;
 			    break;
 		case 60:
 			    Button_Task();
+			    Port_Task();
 			    App_Task();
 			    g_New_Time_Tick_Flag = 0;
 			    break;
 		case 120:
 			    Button_Task();
+			    Port_Task();
 			    App_Task();
 			    Led_Task();
 			    g_New_Time_Tick_Flag = 0;
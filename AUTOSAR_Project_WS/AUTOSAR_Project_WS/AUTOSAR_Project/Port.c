@@ -34,1107 +34,1489 @@ STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 /* Holds the pointer of the Port_PinConfig */
 STATIC const Port_ConfigType *Port_ConfigPtr = NULL_PTR;
 
-/* Contains the allowed modes for each pin */
-Port_PinModeType Port_AllowedModes[NUMBER_OF_MODES];
+/* One bit per port with deferred pins still to be configured by Port_InitContinue */
+STATIC uint8 Port_InitPendingPorts = 0;
+
+#if (PORT_INIT_TIMING == STD_ON)
+/* Time source of the phases, the DWT cycle counter unless redirected by the host tools */
+#ifndef PORT_TIMING_NOW
+#define PORT_TIMING_ENABLE() \
+    do { CORE_DEMCR_REG |= CORE_DEMCR_TRCENA; CORE_DWT_CTRL_REG |= CORE_DWT_CTRL_CYCCNTENA; } while (0)
+#define PORT_TIMING_NOW()               (CORE_DWT_CYCCNT_REG)
+#endif
+
+/* Cycles of each phase of the last Port_Init/Port_InitPins */
+STATIC uint32 Port_InitPhaseCycles[PORT_INIT_NUMBER_OF_PHASES];
+
+/* Time of the last phase mark, phases are only counted during Port_Init/Port_InitPins */
+STATIC uint32 Port_TimingLast = 0;
+STATIC boolean Port_TimingActive = FALSE;
+
+#define PORT_TIMING_START()             Port_TimingStart()
+#define PORT_TIMING_MARK(PHASE)         Port_TimingMark(PHASE)
+#define PORT_TIMING_STOP()              (Port_TimingActive = FALSE)
+#else
+#define PORT_TIMING_START()
+#define PORT_TIMING_MARK(PHASE)
+#define PORT_TIMING_STOP()
+#endif
+
+/* GPIO register blocks of the ports indexed by the port_num member of the pins */
+STATIC Port_GpioRegsType * const Port_GpioBlock[PORT_NUMBER_OF_PORTS] =
+        PORT_GPIO_BLOCK_TABLE;
+
+/* Contains the allowed modes for each pin, one bit per Port_PinModeType value */
+STATIC const uint32 Port_AllowedModes[PORT_NUMBER_OF_PORTS][PORT_NUMBER_OF_PINS_PER_PORT] =
+        PORT_ALLOWED_MODES_TABLE;
+
+/* Check a mode against the allowed modes of a pin with a single AND */
+#define PORT_IS_MODE_ALLOWED(PORT, PIN, MODE) \
+    ((Port_AllowedModes[(PORT)][(PIN)] & PORT_MODE_BIT(MODE)) != 0U)
+
+/* Pins bonded out in each port of the Target HW (PORTE has 6 pins, PORTF has 5 pins) */
+STATIC const uint8 Port_PortPinsMask[PORT_NUMBER_OF_PORTS] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F
+};
+
+/* Current configuration registers of each port (the data bits are not tracked),
+ * loaded by Port_Init and kept in sync by Port_SetPinDirection/Port_SetPinMode
+ * so that Port_ApplyProfile writes only what changes */
+STATIC Port_RegImageType Port_Shadow[PORT_NUMBER_OF_PORTS];
+
+#if (PORT_LOW_POWER_API == STD_ON)
+/* Set by Port_EnterLowPower until Port_ExitLowPower */
+STATIC boolean Port_LowPowerActive = FALSE;
+
+/* Output levels of the ports when entering low power, restored on exit for the parked pins */
+STATIC uint8 Port_LowPowerData[PORT_NUMBER_OF_PORTS];
+
+/* Ports with no live pin in low power, their clocks are gated */
+STATIC uint32 Port_GatedPorts = 0;
+#endif
+
+/************************************************************************************
+ * Description: Replace the bits of Mask in a register with Value (bits outside Mask are
+ *              0), read and written with LDREX/STREX: when an interrupt writes the register
+ *              in between, the store fails and the update is done again on the new value.
+ ************************************************************************************/
+STATIC void Port_UpdateReg(volatile uint32 *Reg, uint32 Mask, uint32 Value)
+{
+    uint32 value = 0;
+
+    do
+    {
+        value = ((uint32) LOAD_EXCLUSIVE(Reg) & ~Mask) | Value;
+    } while (STORE_EXCLUSIVE(value, Reg) != 0U);
+}
+
+/************************************************************************************
+ * Description: Write a register of a port with its image. When the configuration
+ *              owns all the pins of the port the register is written with one store,
+ *              otherwise only the owned bits are changed (e.g. PORTC keeps the JTAG pins).
+ ************************************************************************************/
+STATIC void Port_WriteRegImage(volatile uint32 *Reg, uint32 Mask, uint32 Value, boolean FullPort)
+{
+    if (FullPort == TRUE)
+    {
+        *Reg = Value;
+    }
+    else
+    {
+        Port_UpdateReg(Reg, Mask, Value);
+    }
+}
+
+#if (PORT_INIT_TIMING == STD_ON)
+/************************************************************************************
+ * Description: Clear the phases cycles and start counting.
+ ************************************************************************************/
+STATIC void Port_TimingStart(void)
+{
+    uint8 phase = 0;
+
+    PORT_TIMING_ENABLE();
+
+    for (phase = 0; phase < PORT_INIT_NUMBER_OF_PHASES; phase++)
+    {
+        Port_InitPhaseCycles[phase] = 0;
+    }
+
+    Port_TimingActive = TRUE;
+    Port_TimingLast = PORT_TIMING_NOW();
+}
+
+/************************************************************************************
+ * Description: Add the cycles since the last mark to a phase.
+ ************************************************************************************/
+STATIC void Port_TimingMark(Port_InitPhaseType Phase)
+{
+    uint32 now = 0;
+
+    if (Port_TimingActive == TRUE)
+    {
+        now = PORT_TIMING_NOW();
+        Port_InitPhaseCycles[Phase] += now - Port_TimingLast;
+        Port_TimingLast = now;
+    }
+}
+#endif
+
+/************************************************************************************
+ * Description: Expand a pins mask to the 4 PMCx bits of each pin in GPIOPCTL.
+ ************************************************************************************/
+STATIC uint32 Port_PctlMask(uint8 Mask)
+{
+    uint32 pctl_mask = 0;
+    uint8 pin = 0;
+
+    for (pin = 0; pin < PORT_NUMBER_OF_PINS_PER_PORT; pin++)
+    {
+        if ((Mask & (1U << pin)) != 0U)
+        {
+            pctl_mask |= (uint32) 0x0000000F << (pin * 4);
+        }
+    }
+
+    return pctl_mask;
+}
+
+/************************************************************************************
+ * Description: Unlock GPIOCR and commit the protected pins (PD7/PF0) of a port, their
+ *              GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN bits can then be written.
+ ************************************************************************************/
+STATIC void Port_Unlock(Port_GpioRegsType *Gpio, uint8 Commit)
+{
+    PORT_GPIO(Gpio, LOCK) = PORT_GPIO_LOCK_KEY;
+    Port_UpdateReg(&PORT_GPIO(Gpio, CR), Commit, Commit);
+}
+
+/************************************************************************************
+ * Description: Clear the commit bits of the protected pins while GPIOCR is still
+ *              unlocked and relock it, the pins are protected again.
+ ************************************************************************************/
+STATIC void Port_Relock(Port_GpioRegsType *Gpio, uint8 Commit)
+{
+    Port_UpdateReg(&PORT_GPIO(Gpio, CR), Commit, 0);
+    PORT_GPIO(Gpio, LOCK) = PORT_GPIO_RELOCK_VALUE;
+}
+
+/************************************************************************************
+ * Description: Write all the registers of a port from its image.
+ ************************************************************************************/
+STATIC void Port_ApplyImage(Port_PortType PortNum, const Port_RegImageType *Image)
+{
+    Port_GpioRegsType *gpio = Port_GpioBlock[PortNum];
+    uint32 mask = Image->mask;
+    uint32 pctl_mask = Port_PctlMask(Image->mask);
+    boolean full_port = (boolean)(Image->mask == Port_PortPinsMask[PortNum]);
+
+    if (Image->commit != 0U)
+    {
+        /* One unlock for all the protected pins of the port, relocked after the writes */
+        Port_Unlock(gpio, Image->commit);
+    }
+    PORT_TIMING_MARK(PORT_INIT_PHASE_UNLOCK);
+
+    Port_WriteRegImage(&PORT_GPIO(gpio, AMSEL), mask, Image->amsel, full_port);
+    Port_WriteRegImage(&PORT_GPIO(gpio, PCTL), pctl_mask, Image->pctl, full_port);
+    Port_WriteRegImage(&PORT_GPIO(gpio, AFSEL), mask, Image->afsel, full_port);
+    PORT_TIMING_MARK(PORT_INIT_PHASE_MODE);
+
+    Port_WriteRegImage(&PORT_GPIO(gpio, PUR), mask, Image->pur, full_port);
+    Port_WriteRegImage(&PORT_GPIO(gpio, PDR), mask, Image->pdr, full_port);
+
+    /* Pad control before the pins are switched to output, so an open drain pin never drives high.
+     * Setting a pin in one drive register clears it in the two others, GPIOSLR needs GPIODR8R */
+    Port_WriteRegImage(&PORT_GPIO(gpio, DR2R), mask, Image->dr2r, full_port);
+    Port_WriteRegImage(&PORT_GPIO(gpio, DR4R), mask, Image->dr4r, full_port);
+    Port_WriteRegImage(&PORT_GPIO(gpio, DR8R), mask, Image->dr8r, full_port);
+    Port_WriteRegImage(&PORT_GPIO(gpio, SLR), mask, Image->slr, full_port);
+    Port_WriteRegImage(&PORT_GPIO(gpio, ODR), mask, Image->odr, full_port);
+    PORT_TIMING_MARK(PORT_INIT_PHASE_PULLS);
+
+    /* Initial value of the output pins through the GPIODATA address masked with the owned pins
+     * (one store, no read-modify-write), written before the pins are switched to output */
+    PORT_GPIO(gpio, DATA[mask]) = Image->data;
+
+    Port_WriteRegImage(&PORT_GPIO(gpio, DIR), mask, Image->dir, full_port);
+    PORT_TIMING_MARK(PORT_INIT_PHASE_DIRECTION);
+
+    Port_WriteRegImage(&PORT_GPIO(gpio, DEN), mask, Image->den, full_port);
+    PORT_TIMING_MARK(PORT_INIT_PHASE_MODE);
+
+    if (Image->commit != 0U)
+    {
+        Port_Relock(gpio, Image->commit);
+    }
+    PORT_TIMING_MARK(PORT_INIT_PHASE_UNLOCK);
+}
+
+/************************************************************************************
+ * Description: Merge the pins of an image written by Port_ApplyImage into the shadow of
+ *              its port, the other pins of the shadow are kept.
+ ************************************************************************************/
+STATIC void Port_ShadowMergeImage(Port_PortType PortNum, const Port_RegImageType *Image)
+{
+    Port_RegImageType *Shadow = &Port_Shadow[PortNum];
+    uint8 keep = (uint8) ~Image->mask;
+
+    Shadow->mask |= Image->mask;
+    Shadow->commit |= Image->commit;
+    Shadow->dir = (Shadow->dir & keep) | Image->dir;
+    Shadow->den = (Shadow->den & keep) | Image->den;
+    Shadow->afsel = (Shadow->afsel & keep) | Image->afsel;
+    Shadow->amsel = (Shadow->amsel & keep) | Image->amsel;
+    Shadow->pur = (Shadow->pur & keep) | Image->pur;
+    Shadow->pdr = (Shadow->pdr & keep) | Image->pdr;
+    Shadow->dir_refresh = (Shadow->dir_refresh & keep) | Image->dir_refresh;
+    Shadow->dr2r = (Shadow->dr2r & keep) | Image->dr2r;
+    Shadow->dr4r = (Shadow->dr4r & keep) | Image->dr4r;
+    Shadow->dr8r = (Shadow->dr8r & keep) | Image->dr8r;
+    Shadow->slr = (Shadow->slr & keep) | Image->slr;
+    Shadow->odr = (Shadow->odr & keep) | Image->odr;
+    Shadow->pctl = (Shadow->pctl & ~Port_PctlMask(Image->mask)) | Image->pctl;
+}
+
+/************************************************************************************
+ * Description: Write a register of a port only if its new value differs from the shadow,
+ *              changing only the bits that differ unless the configuration owns the whole port.
+ ************************************************************************************/
+STATIC void Port_WriteRegDiff(volatile uint32 *Reg, uint32 Old, uint32 New, boolean FullPort)
+{
+    if (Old != New)
+    {
+        Port_WriteRegImage(Reg, Old ^ New, (FullPort == TRUE) ? New : (New & (Old ^ New)), FullPort);
+    }
+}
+
+/************************************************************************************
+ * Description: Switch the pins of a profile image of a port, writing only the registers
+ *              that change, in the same order as Port_ApplyImage, and update the shadow.
+ ************************************************************************************/
+STATIC void Port_ApplyImageDiff(Port_PortType PortNum, const Port_RegImageType *Image)
+{
+    Port_RegImageType *Shadow = &Port_Shadow[PortNum];
+    Port_GpioRegsType *gpio = Port_GpioBlock[PortNum];
+    uint8 keep = (uint8) ~Image->mask;
+    uint32 pctl_mask = Port_PctlMask(Image->mask);
+    boolean full_port = (boolean)(Shadow->mask == Port_PortPinsMask[PortNum]);
+    uint8 changed = 0;
+    uint8 commit = 0;
+    uint8 pin = 0;
+    Port_RegImageType New = *Shadow;
+
+    New.dir = (Shadow->dir & keep) | Image->dir;
+    New.den = (Shadow->den & keep) | Image->den;
+    New.afsel = (Shadow->afsel & keep) | Image->afsel;
+    New.amsel = (Shadow->amsel & keep) | Image->amsel;
+    New.pur = (Shadow->pur & keep) | Image->pur;
+    New.pdr = (Shadow->pdr & keep) | Image->pdr;
+    New.dr2r = (Shadow->dr2r & keep) | Image->dr2r;
+    New.dr4r = (Shadow->dr4r & keep) | Image->dr4r;
+    New.dr8r = (Shadow->dr8r & keep) | Image->dr8r;
+    New.slr = (Shadow->slr & keep) | Image->slr;
+    New.odr = (Shadow->odr & keep) | Image->odr;
+    New.pctl = (Shadow->pctl & ~pctl_mask) | Image->pctl;
+
+    /* Pins of the profile with a different configuration */
+    changed = (uint8)((New.dir ^ Shadow->dir) | (New.den ^ Shadow->den) | (New.afsel ^ Shadow->afsel)
+            | (New.amsel ^ Shadow->amsel) | (New.pur ^ Shadow->pur) | (New.pdr ^ Shadow->pdr)
+            | (New.dr2r ^ Shadow->dr2r) | (New.dr4r ^ Shadow->dr4r) | (New.dr8r ^ Shadow->dr8r)
+            | (New.slr ^ Shadow->slr) | (New.odr ^ Shadow->odr));
+    for (pin = 0; pin < PORT_NUMBER_OF_PINS_PER_PORT; pin++)
+    {
+        if ((((New.pctl ^ Shadow->pctl) >> (pin * 4)) & 0x0000000F) != 0U)
+        {
+            changed |= (uint8)(1U << pin);
+        }
+    }
+
+    if (changed == 0U)
+    {
+        /* Do Nothing ... the port is already in the profile configuration */
+        return;
+    }
+
+    /* Protected pins of the profile with a different configuration */
+    commit = Image->commit & changed;
+    if (commit != 0U)
+    {
+        Port_Unlock(gpio, commit);
+    }
+
+    Port_WriteRegDiff(&PORT_GPIO(gpio, AMSEL), Shadow->amsel, New.amsel, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, PCTL), Shadow->pctl, New.pctl, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, AFSEL), Shadow->afsel, New.afsel, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, PUR), Shadow->pur, New.pur, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, PDR), Shadow->pdr, New.pdr, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, DR2R), Shadow->dr2r, New.dr2r, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, DR4R), Shadow->dr4r, New.dr4r, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, DR8R), Shadow->dr8r, New.dr8r, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, SLR), Shadow->slr, New.slr, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, ODR), Shadow->odr, New.odr, full_port);
+
+    /* Initial value of the reconfigured output pins, before they are switched to output */
+    if ((changed & Image->dir) != 0U)
+    {
+        PORT_GPIO(gpio, DATA[changed & Image->dir]) = Image->data;
+    }
+
+    Port_WriteRegDiff(&PORT_GPIO(gpio, DIR), Shadow->dir, New.dir, full_port);
+    Port_WriteRegDiff(&PORT_GPIO(gpio, DEN), Shadow->den, New.den, full_port);
+
+    if (commit != 0U)
+    {
+        Port_Relock(gpio, commit);
+    }
+
+    *Shadow = New;
+}
+
+#if (PORT_INTEGRITY_CHECK_API == STD_ON)
+/* Registers compared by Port_CheckIntegrity, in the scan order of each port */
+#define PORT_INTEGRITY_NUMBER_OF_REGS       (12U)
+
+/* Index of GPIOPCTL, compared with the 4 PMCx bits of each pin */
+#define PORT_INTEGRITY_PCTL_REG             (11U)
+
+/* Next port and register index checked by Port_CheckIntegrity */
+STATIC Port_PortType Port_IntegrityPort = 0;
+STATIC uint8 Port_IntegrityReg = 0;
+
+/************************************************************************************
+ * Description: Get a register compared by Port_CheckIntegrity and its expected value
+ *              from the shadow of its port.
+ ************************************************************************************/
+STATIC volatile uint32 * Port_IntegrityRegister(Port_GpioRegsType *Gpio, const Port_RegImageType *Shadow,
+                                                uint8 RegIndex, uint32 *Expected)
+{
+    volatile uint32 *reg = NULL_PTR;
+
+    switch (RegIndex)
+    {
+    case 0:
+        reg = &PORT_GPIO(Gpio, DIR);
+        *Expected = Shadow->dir;
+        break;
+    case 1:
+        reg = &PORT_GPIO(Gpio, AFSEL);
+        *Expected = Shadow->afsel;
+        break;
+    case 2:
+        reg = &PORT_GPIO(Gpio, PUR);
+        *Expected = Shadow->pur;
+        break;
+    case 3:
+        reg = &PORT_GPIO(Gpio, PDR);
+        *Expected = Shadow->pdr;
+        break;
+    case 4:
+        reg = &PORT_GPIO(Gpio, DEN);
+        *Expected = Shadow->den;
+        break;
+    case 5:
+        reg = &PORT_GPIO(Gpio, AMSEL);
+        *Expected = Shadow->amsel;
+        break;
+    case 6:
+        reg = &PORT_GPIO(Gpio, DR2R);
+        *Expected = Shadow->dr2r;
+        break;
+    case 7:
+        reg = &PORT_GPIO(Gpio, DR4R);
+        *Expected = Shadow->dr4r;
+        break;
+    case 8:
+        reg = &PORT_GPIO(Gpio, DR8R);
+        *Expected = Shadow->dr8r;
+        break;
+    case 9:
+        reg = &PORT_GPIO(Gpio, SLR);
+        *Expected = Shadow->slr;
+        break;
+    case 10:
+        reg = &PORT_GPIO(Gpio, ODR);
+        *Expected = Shadow->odr;
+        break;
+    default:
+        reg = &PORT_GPIO(Gpio, PCTL);
+        *Expected = Shadow->pctl;
+        break;
+    }
+
+    return reg;
+}
+#endif
+
+#if (PORT_PIN_STATE_API == STD_ON)
+/************************************************************************************
+ * Description: Read the registers of a port once (8 reads) and decode the states of
+ *              its 8 pins, the clock of the port has to be enabled.
+ ************************************************************************************/
+STATIC void Port_ReadPortStates(Port_PortType PortNum, Port_PinStateType *States)
+{
+    Port_GpioRegsType *gpio = Port_GpioBlock[PortNum];
+    uint32 data = PORT_GPIO(gpio, DATA[PORT_DATA_ALL_PINS]);
+    uint32 dir = PORT_GPIO(gpio, DIR);
+    uint32 den = PORT_GPIO(gpio, DEN);
+    uint32 afsel = PORT_GPIO(gpio, AFSEL);
+    uint32 amsel = PORT_GPIO(gpio, AMSEL);
+    uint32 pur = PORT_GPIO(gpio, PUR);
+    uint32 pdr = PORT_GPIO(gpio, PDR);
+    uint32 pctl = PORT_GPIO(gpio, PCTL);
+    uint8 pin = 0;
+
+    for (pin = 0; pin < PORT_NUMBER_OF_PINS_PER_PORT; pin++)
+    {
+        States[pin] = (Port_PinStateType)(((data >> pin) & 1U)
+                | (((dir >> pin) & 1U) << 1)
+                | (((den >> pin) & 1U) << 2)
+                | (((afsel >> pin) & 1U) << 3)
+                | (((amsel >> pin) & 1U) << 4)
+                | (((pur >> pin) & 1U) << 5)
+                | (((pdr >> pin) & 1U) << 6)
+                | (((pctl >> (pin * 4)) & 0x0000000F) << PORT_PIN_STATE_PCTL_SHIFT));
+    }
+}
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+/************************************************************************************
+ * Description: Set the mode bits of a pin in the shadow of its port.
+ ************************************************************************************/
+STATIC void Port_ShadowSetMode(Port_RegImageType *Shadow, Port_PinType PinNum, Port_PinModeType Mode)
+{
+    uint8 bit = (uint8)(1U << PinNum);
+
+    Shadow->amsel &= (uint8) ~bit;
+    Shadow->afsel &= (uint8) ~bit;
+    Shadow->den &= (uint8) ~bit;
+    Shadow->pctl &= ~((uint32) 0x0000000F << (PinNum * 4));
+
+    if (Mode == GPIO_MODE)
+    {
+        Shadow->den |= bit;
+    }
+    else if (Mode == ANALOG)
+    {
+        Shadow->amsel |= bit;
+    }
+    else /* Another mode */
+    {
+        Shadow->afsel |= bit;
+        Shadow->den |= bit;
+        Shadow->pctl |= ((uint32) Mode & 0x0000000F) << (PinNum * 4);
+    }
+}
+#endif
+
+/************************************************************************************************************************************************************************************************************************************************************
+ *                                                                                                                                                                                                                                                          *
+ *************************************************************************************************************************************************************************************************************************************************************/
+
+/************************************************************************************
+ * Service Name: Port_Init
+ * Service ID: 0x00
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): ConfigPtr - Pointer to configuration set
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to Initialize the Port Driver module, only the critical pins
+ *              are written, the deferred pins are configured by Port_InitContinue.
+ ************************************************************************************/
+void Port_Init(const Port_ConfigType *ConfigPtr)
+{
+    /* Loop counter to write the registers of all the ports */
+    Port_PortType port = 0;
+
+    /* One bit per port used by the configuration (RCGCGPIO/PRGPIO bit order) */
+    uint32 used_ports = 0;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer and its registers images are not a NULL_PTR */
+    if ((ConfigPtr == NULL_PTR) || (ConfigPtr->Images == NULL_PTR) || (ConfigPtr->CriticalImages == NULL_PTR))
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID,
+        PORT_E_PARAM_CONFIG);
+    }
+    else
+#endif
+    {
+        /* When this function is called, it means that the Port is now initialized */
+        Port_Status = PORT_INITIALIZED;
+
+        /* For easier, more understandable code */
+        Port_ConfigPtr = ConfigPtr;
+
+        /*
+         * No check per pin: the modes, the JTAG pins and the locked pins are checked at
+         * compile time by PORT_PIN_CONFIG (Port_PBcfg.c), and the registers images with
+         * the PD7/PF0 commit bits are generated from the pins by Tools/PortCfgGen.
+         */
+
+        /* Ports used by the configuration, the other ports stay clock-gated */
+        for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+        {
+            if (Port_ConfigPtr->Images[port].mask != 0U)
+            {
+                used_ports |= (uint32) 1U << port;
+            }
+        }
+
+        PORT_TIMING_START();
+
+        /* Enable clock for the used PORTs with one write and wait once for all of them to be ready */
+        Port_UpdateReg(&SYSCTL_RCGCGPIO_REG, used_ports, used_ports);
+        while ((SYSCTL_PRGPIO_REG & used_ports) != used_ports);
+        PORT_TIMING_MARK(PORT_INIT_PHASE_CLOCK);
+
+        /*
+         * Loop to write the images of the critical pins, each register is written once per port.
+         * The shadow holds the critical pins only, the deferred pins are written and merged into
+         * the shadow by Port_InitContinue.
+         */
+        Port_InitPendingPorts = 0;
+        for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+        {
+            Port_Shadow[port] = Port_ConfigPtr->CriticalImages[port];
+
+            if (Port_ConfigPtr->CriticalImages[port].mask != 0U)
+            {
+                Port_ApplyImage(port, &Port_ConfigPtr->CriticalImages[port]);
+            }
+
+            if ((Port_ConfigPtr->Images[port].mask & (uint8) ~Port_ConfigPtr->CriticalImages[port].mask) != 0U)
+            {
+                Port_InitPendingPorts |= (uint8)(1U << port);
+            }
+        }
+
+        PORT_TIMING_STOP();
+    }
+}
+
+/************************************************************************************
+ * Service Name: Port_InitContinue
+ * Service ID: 0x0A
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE when all the pins are configured, FALSE while ports are pending
+ * Description: Function to configure the deferred pins of the next pending port and merge
+ *              them into its shadow, the critical pins already written by Port_Init (and
+ *              changed at run time since) are not touched again.
+ ************************************************************************************/
+boolean Port_InitContinue(void)
+{
+    Port_PortType port = 0;
+    uint8 mask = 0;
+    const Port_RegImageType *Image = NULL_PTR;
+    Port_RegImageType Deferred;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_CONTINUE_SID,
+        PORT_E_UNINIT);
+    }
+    else
+#endif
+    if (Port_InitPendingPorts != 0U)
+    {
+        /* Lowest pending port */
+        while ((Port_InitPendingPorts & (1U << port)) == 0U)
+        {
+            port++;
+        }
+
+        /* Image of the port restricted to its deferred pins */
+        Image = &Port_ConfigPtr->Images[port];
+        mask = Image->mask & (uint8) ~Port_ConfigPtr->CriticalImages[port].mask;
+
+        Deferred.mask = mask;
+        Deferred.dir = Image->dir & mask;
+        Deferred.data = Image->data & mask;
+        Deferred.den = Image->den & mask;
+        Deferred.afsel = Image->afsel & mask;
+        Deferred.amsel = Image->amsel & mask;
+        Deferred.pur = Image->pur & mask;
+        Deferred.pdr = Image->pdr & mask;
+        Deferred.commit = Image->commit & mask;
+        Deferred.dir_refresh = Image->dir_refresh & mask;
+        Deferred.dr2r = Image->dr2r & mask;
+        Deferred.dr4r = Image->dr4r & mask;
+        Deferred.dr8r = Image->dr8r & mask;
+        Deferred.slr = Image->slr & mask;
+        Deferred.odr = Image->odr & mask;
+        Deferred.pctl = Image->pctl & Port_PctlMask(mask);
+
+        Port_ApplyImage(port, &Deferred);
+        Port_ShadowMergeImage(port, &Deferred);
+
+        Port_InitPendingPorts &= (uint8) ~(1U << port);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return (boolean)(Port_InitPendingPorts == 0U);
+}
+
+/************************************************************************************
+ * Service Name: Port_InitPins
+ * Service ID: 0x09
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): Pins - Pointer to the pins to configure
+ *                  NumberOfPins - Number of pins in Pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to configure only the given pins, batched per port.
+ ************************************************************************************/
+void Port_InitPins(const Port_ConfigPin *Pins, uint8 NumberOfPins)
+{
+    /* Images of the given pins only, the mask of each port selects the written bits */
+    Port_RegImageType Images[PORT_NUMBER_OF_PORTS] = {{0}};
+    uint32 used_ports = 0;
+    uint8 index = 0;
+    Port_PortType port = 0;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input pins pointer is not a NULL_PTR */
+    if (Pins == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_PINS_SID,
+        PORT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        for (index = 0; index < NumberOfPins; index++)
+        {
+            if ((Pins[index].port_num >= PORT_NUMBER_OF_PORTS)
+                    || ((Port_PortPinsMask[Pins[index].port_num] & (1U << Pins[index].pin_num)) == 0U))
+            {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+                Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_PINS_SID,
+                PORT_E_PARAM_PIN);
+#endif
+            }
+            else if (PORT_PIN_IS_RESERVED(Pins[index].port_num, Pins[index].pin_num))
+            {
+                /* Do Nothing ...  JTAG pins (and PD7/PF0 when they are not unlocked) */
+            }
+            else if (PORT_IS_MODE_ALLOWED(Pins[index].port_num, Pins[index].pin_num, Pins[index].mode) == FALSE)
+            {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+                Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_PINS_SID,
+                PORT_E_PARAM_INVALID_MODE);
+#endif
+            }
+            else
+            {
+                Port_AddPinToImage(&Pins[index], &Images[Pins[index].port_num]);
+                used_ports |= (uint32) 1U << Pins[index].port_num;
+            }
+        }
+
+        PORT_TIMING_START();
+
+        /* Enable clock for the PORTs of the pins with one write and wait once for all of them */
+        Port_UpdateReg(&SYSCTL_RCGCGPIO_REG, used_ports, used_ports);
+        while ((SYSCTL_PRGPIO_REG & used_ports) != used_ports);
+        PORT_TIMING_MARK(PORT_INIT_PHASE_CLOCK);
+
+        for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+        {
+            if (Images[port].mask != 0U)
+            {
+                /* One write per register of the port, the other pins of the port are kept */
+                Port_ApplyImage(port, &Images[port]);
+
+                /* The shadow takes the new pins for the integrity check and the profiles */
+                Port_ShadowMergeImage(port, &Images[port]);
+            }
+        }
+
+        PORT_TIMING_STOP();
+    }
+}
+
+/************************************************************************************
+ * Service Name: Port_SetPinDirection
+ * Service ID: 0x01
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Pin - Port Pin ID number , Direction - Port Pin Direction
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to Sets the port pin direction.
+ ************************************************************************************/
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
+{
+    /* Registers of the pin resolved by the generator, no lookup of the port */
+    const Port_PinDescType *Desc = NULL_PTR;
+    Port_GpioRegsType *gpio = NULL_PTR;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID,
+        PORT_E_UNINIT);
+    }
+    else
+    { /* Do Nothing */
+    }
+
+    /* check if incorrect Port Pin ID passed */
+    if (Pin >= PORT_NUMBER_OF_PORT_PINS)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID,
+        PORT_E_PARAM_PIN);
+    }
+    else
+    { /* Do Nothing */
+    }
+
+    /* check if Port Pin not configured as changeable */
+    if (Port_ConfigPtr->Pin[Pin].pin_dir_changeable == STD_OFF)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID,
+        PORT_E_DIRECTION_UNCHANGEABLE);
+    }
+    else
+    { /* Do Nothing */
+    }
+#endif
 
-/************************************************************************************************************************************************************************************************************************************************************
- *                                                                                                                                                                                                                                                          *
- *************************************************************************************************************************************************************************************************************************************************************/
+    Desc = &Port_ConfigPtr->PinDesc[Pin];
+    gpio = PORT_GPIO_BLOCK(Desc->base);
+
+    /* GPIODIR is not protected by GPIOCR, PD7/PF0 need no unlock here */
+    if (Desc->allowed_modes == 0U)
+    {
+        /* Do Nothing ...  this is the JTAG pins (and PD7/PF0 when they are not unlocked) */
+        return;
+    }
+
+    if (Direction == PORT_PIN_OUT)
+    {
+        /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+        Port_UpdateReg(&PORT_GPIO(gpio, DIR), Desc->bit, Desc->bit);
+        Port_Shadow[Desc->port_num].dir |= Desc->bit;
+    }
+    else if (Direction == PORT_PIN_IN)
+    {
+        /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+        Port_UpdateReg(&PORT_GPIO(gpio, DIR), Desc->bit, 0);
+        Port_Shadow[Desc->port_num].dir &= (uint8) ~Desc->bit;
+    }
+    else
+    { /* Do Nothing */
+    }
+}
+#endif
 
 /************************************************************************************
- * Service Name: Port_Init
- * Service ID: 0x00
+ * Service Name: Port_RefreshPortDirection
+ * Service ID: 0x02
  * Sync/Async: Synchronous
  * Reentrancy: Non reentrant
- * Parameters (in): ConfigPtr - Pointer to configuration set
+ * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to Initialize the Port Driver module.
+ * Description: Refreshes port direction.
  ************************************************************************************/
-void Port_Init(const Port_ConfigType *ConfigPtr)
+void Port_RefreshPortDirection(void)
 {
-    /* Loop counter to check on all configured pins */
-    Port_PinType counter = 0;
+    /* Loop counter to refresh the ports one by one */
+    Port_PortType port = 0;
 
-    /* Index counter to deal with allowed mode array Port_AllowedModes[i] */
-    uint8 i = 0;
+    /* Image of the port to refresh */
+    const Port_RegImageType *Image = NULL_PTR;
 
-    /* Flag to indicate if a mode is allowed for a pin or not (POSITIVE LOGIC) */
-    boolean b_AllowedModeMatched = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+        PORT_REFRESH_PORT_DIR_SID,
+                        PORT_E_UNINIT);
+    }
+    else
+#endif
+    {
+        for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+        {
+            Image = &Port_ConfigPtr->Images[port];
 
+            /* PORT061: The function Port_RefreshPortDirection shall exclude those port pins from
+             * refreshing that are configured as pin direction changeable during runtime.
+             * dir_refresh holds the other pins (JTAG pins excluded), one update per port */
+            if (Image->dir_refresh != 0U)
+            {
+                Port_UpdateReg(&PORT_GPIO(Port_GpioBlock[port], DIR), Image->dir_refresh,
+                               (uint32) Image->dir & (uint32) Image->dir_refresh);
+            }
+        }
+    }
+}
 
+/************************************************************************************
+ * Service Name: Port_GetVersionInfo
+ * Service ID: 0x03
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+ * Return value: None
+ * Description: Returns the version information of this module.
+ ************************************************************************************/
+#if (PORT_VERSION_INFO_API == STD_ON)
+void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* check if the input configuration pointer is not a NULL_PTR */
-    if (ConfigPtr == NULL_PTR)
+    if (versioninfo == NULL_PTR)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID,
-        PORT_E_PARAM_CONFIG);
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+        PORT_GET_VERSION_INFO_SID,
+                        PORT_E_PARAM_POINTER);
+    }
+    else
+    { /* Do Nothing */
+    }
+
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+        PORT_GET_VERSION_INFO_SID,
+                        PORT_E_UNINIT);
     }
     else
     { /* Do Nothing */
     }
 #endif
 
-    /* When this function is called, it means that the Port is now initialized */
-    Port_Status = PORT_INITIALIZED;
+    /* Copy the module Id */
+    versioninfo->moduleID = (uint16) PORT_MODULE_ID;
+    /* Copy the vendor Id */
+    versioninfo->vendorID = (uint16) PORT_VENDOR_ID;
+    /* Copy Software Major Version */
+    versioninfo->sw_major_version = (uint8) PORT_SW_MAJOR_VERSION;
+    /* Copy Software Minor Version */
+    versioninfo->sw_minor_version = (uint8) PORT_SW_MINOR_VERSION;
+    /* Copy Software Patch Version */
+    versioninfo->sw_patch_version = (uint8) PORT_SW_PATCH_VERSION;
+}
+#endif
 
-    /* For easier, more understandable code */
-    Port_ConfigPtr = ConfigPtr;
+/************************************************************************************
+ * Service Name: Port_SetPinMode
+ * Service ID: 0x04
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Pin - Port Pin ID number, Mode - New Port Pin mode to be set on port pin
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the port pin mode.
+ ************************************************************************************/
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+{
+    /* Registers of the pin resolved by the generator, no lookup of the port */
+    const Port_PinDescType *Desc = NULL_PTR;
+    Port_GpioRegsType *gpio = NULL_PTR;
+    uint32 pctl_mask = 0;
 
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
+        PORT_E_UNINIT);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
 
-    /* Loop to do the following to all the configured pins in Port_PBcfg.c file:
-     * 1- Detect the corresponding port
-     * 2- Detect the corresponding pin
-     * 3- Set the Port_AllowedModes[] array to the allowed modes for this pin according to Target HW specification
-     * 4- Enable clock for the corresponding port
-     * 5- Configure the pin to according to Port_ConfigPtr
-     *      A- Direction
-     *      B- Resistance
-     *      C- Mode
-     *      D- Initial Value
-     *  */
-    for (counter = 0; counter < PORT_NUMBER_OF_PORT_PINS; counter++)
+    /* check if incorrect Port Pin ID passed */
+    if (Pin >= PORT_NUMBER_OF_PORT_PINS)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
+        PORT_E_PARAM_PIN);
+    }
+    else
     {
+        /* Do Nothing */
+    }
 
-        volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-        volatile uint32 delay = 0;
-        /* Clear the Port_AllowedModes[i] container */
-        for (i = 0; i < NUMBER_OF_MODES; i++)
-        {
-            Port_AllowedModes[i] = GPIO_MODE;
-        }
-        /* Clear the array index for next use */
-        i = 0;
-        switch (Port_ConfigPtr->Pin[counter].port_num) /* get the corresponding port */
+    /* check if the API called when the mode is unchangeable */
+    if (Port_ConfigPtr->Pin[Pin].pin_mode_changeable == STD_OFF)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
+        PORT_E_MODE_UNCHANGEABLE);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+
+    Desc = &Port_ConfigPtr->PinDesc[Pin];
+    gpio = PORT_GPIO_BLOCK(Desc->base);
+    pctl_mask = (uint32) 0x0000000F << Desc->pctl_shift;
+
+    if (Desc->allowed_modes == 0U)
+    {
+        /* Do Nothing ...  this is the JTAG pins (and PD7/PF0 when they are not unlocked) */
+        return;
+    }
+
+    /* Check if the specified mode is applicable to the selected pin */
+    if ((Desc->allowed_modes & PORT_MODE_BIT(Mode)) == 0U)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* Report a Det error if the mode is inapplicable to the specified pin */
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
+        PORT_E_PARAM_INVALID_MODE);
+#endif
+    }
+    else
+    {
+        if (Desc->commit != 0U)
         {
-        case 0:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-            switch (Port_ConfigPtr->Pin[counter].pin_num) /* get the corresponding pin */
-            {
-            /* add the allowed mode to the Port_AllowedModes[] array */
-            case 0:
-            case 1:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT8;
-                break;
-            case 2:
-            case 3:
-            case 4:
-            case 5:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT2;
-                break;
-            case 6:
-            case 7:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT3;
-                Port_AllowedModes[2] = ALT5;
-                break;
-            }
-            break;
-        case 1:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-            switch (Port_ConfigPtr->Pin[counter].pin_num)
-            {
-            case 0:
-            case 1:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT7;
-                Port_AllowedModes[3] = ANALOG;
-                break;
-            case 2:
-            case 3:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT3;
-                Port_AllowedModes[2] = ALT7;
-                break;
-            case 4:
-            case 5:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT2;
-                Port_AllowedModes[2] = ALT4;
-                Port_AllowedModes[3] = ALT7;
-                Port_AllowedModes[4] = ALT8;
-                Port_AllowedModes[5] = ANALOG;
-                break;
-            case 6:
-            case 7:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT2;
-                Port_AllowedModes[2] = ALT4;
-                Port_AllowedModes[3] = ALT7;
-                break;
-            }
-            break;
-        case 2:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-            switch (Port_ConfigPtr->Pin[counter].pin_num)
-            {
-            case 0:
-            case 1:
-            case 2:
-            case 3:
-                break;
-            case 4:
-            case 5:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT2;
-                Port_AllowedModes[3] = ALT4;
-                Port_AllowedModes[4] = ALT6;
-                Port_AllowedModes[5] = ALT7;
-                Port_AllowedModes[6] = ALT8;
-                Port_AllowedModes[7] = ANALOG;
-                break;
-            case 6:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT6;
-                Port_AllowedModes[3] = ALT7;
-                Port_AllowedModes[4] = ALT8;
-                Port_AllowedModes[5] = ANALOG;
-                break;
-            case 7:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT7;
-                Port_AllowedModes[3] = ALT8;
-                Port_AllowedModes[4] = ANALOG;
-                break;
-            }
-            break;
-        case 3:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-            switch (Port_ConfigPtr->Pin[counter].pin_num)
-            {
-            case 0:
-            case 1:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT2;
-                Port_AllowedModes[3] = ALT3;
-                Port_AllowedModes[4] = ALT4;
-                Port_AllowedModes[5] = ALT5;
-                Port_AllowedModes[6] = ALT7;
-                Port_AllowedModes[7] = ANALOG;
-                break;
-            case 2:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT2;
-                Port_AllowedModes[3] = ALT4;
-                Port_AllowedModes[4] = ALT7;
-                Port_AllowedModes[5] = ALT8;
-                Port_AllowedModes[6] = ANALOG;
-                break;
-            case 3:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT2;
-                Port_AllowedModes[3] = ALT6;
-                Port_AllowedModes[4] = ALT7;
-                Port_AllowedModes[5] = ALT8;
-                Port_AllowedModes[6] = ANALOG;
-                break;
-            case 4:
-            case 5:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT7;
-                Port_AllowedModes[3] = ANALOG;
-                break;
-            case 6:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT4;
-                Port_AllowedModes[3] = ALT6;
-                Port_AllowedModes[4] = ALT7;
-                break;
-            case 7:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT6;
-                Port_AllowedModes[3] = ALT7;
-                Port_AllowedModes[4] = ALT8;
-                break;
-            }
-            break;
-        case 4:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-            switch (Port_ConfigPtr->Pin[counter].pin_num)
-            {
-            case 0:
-            case 1:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ANALOG;
-                break;
-            case 2:
-            case 3:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ANALOG;
-                break;
-            case 4:
-            case 5:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT3;
-                Port_AllowedModes[3] = ALT4;
-                Port_AllowedModes[4] = ALT5;
-                Port_AllowedModes[5] = ALT8;
-                Port_AllowedModes[6] = ANALOG;
-                break;
-            }
-            break;
-        case 5:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-            switch (Port_ConfigPtr->Pin[counter].pin_num)
-            {
-            case 0:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT2;
-                Port_AllowedModes[3] = ALT3;
-                Port_AllowedModes[4] = ALT5;
-                Port_AllowedModes[5] = ALT6;
-                Port_AllowedModes[6] = ALT7;
-                Port_AllowedModes[7] = ALT8;
-                Port_AllowedModes[8] = ALT9;
-                break;
-            case 1:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT1;
-                Port_AllowedModes[2] = ALT2;
-                Port_AllowedModes[3] = ALT5;
-                Port_AllowedModes[4] = ALT6;
-                Port_AllowedModes[5] = ALT7;
-                Port_AllowedModes[6] = ALT9;
-                Port_AllowedModes[7] = ALT10;
-                break;
-            case 2:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT2;
-                Port_AllowedModes[2] = ALT4;
-                Port_AllowedModes[3] = ALT5;
-                Port_AllowedModes[4] = ALT7;
-                Port_AllowedModes[5] = ALT10;
-                break;
-            case 3:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT2;
-                Port_AllowedModes[2] = ALT3;
-                Port_AllowedModes[3] = ALT5;
-                Port_AllowedModes[4] = ALT7;
-                Port_AllowedModes[5] = ALT10;
-                break;
-            case 4:
-                Port_AllowedModes[0] = GPIO_MODE;
-                Port_AllowedModes[1] = ALT5;
-                Port_AllowedModes[2] = ALT6;
-                Port_AllowedModes[3] = ALT7;
-                Port_AllowedModes[4] = ALT8;
-                break;
-            }
-            break;
+            /* Same unlock/relock path as the images writes */
+            Port_Unlock(gpio, Desc->commit);
         }
 
-        /* Enable clock for PORT and allow time for clock to start*/
-        SYSCTL_REGCGC2_REG |= (1 << Port_ConfigPtr->Pin[counter].port_num);
-        delay = SYSCTL_REGCGC2_REG;
-
-        if (((Port_ConfigPtr->Pin[counter].port_num == 3)
-                && (Port_ConfigPtr->Pin[counter].pin_num == 7))
-                || ((Port_ConfigPtr->Pin[counter].port_num == 5)
-                        && (Port_ConfigPtr->Pin[counter].pin_num == 0))) /* PD7 or PF0 */
+        if (Mode == GPIO_MODE)
         {
-            /* Unlock the GPIOCR register */
-            *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                    + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
+            /* Disable the analog functionality and the alternative function of this pin */
+            Port_UpdateReg(&PORT_GPIO(gpio, AMSEL), Desc->bit, 0);
+            Port_UpdateReg(&PORT_GPIO(gpio, AFSEL), Desc->bit, 0);
 
-            /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET),
-                    Port_ConfigPtr->Pin[counter].pin_num);
+            /* Clear the PMCx bits for this pin */
+            Port_UpdateReg(&PORT_GPIO(gpio, PCTL), pctl_mask, 0);
+
+            /* Enable the digital functionality on this pin */
+            Port_UpdateReg(&PORT_GPIO(gpio, DEN), Desc->bit, Desc->bit);
         }
-        else if ((Port_ConfigPtr->Pin[counter].port_num == 2)
-                && (Port_ConfigPtr->Pin[counter].pin_num <= 3)) /* PC0 to PC3 */
+        else if (Mode == ANALOG)
         {
-            /* Do Nothing ... JTAG pins */
-            continue;
+            /* Disable the digital functionality and the alternative function of this pin */
+            Port_UpdateReg(&PORT_GPIO(gpio, DEN), Desc->bit, 0);
+            Port_UpdateReg(&PORT_GPIO(gpio, AFSEL), Desc->bit, 0);
+
+            /* Clear the PMCx bits for this pin */
+            Port_UpdateReg(&PORT_GPIO(gpio, PCTL), pctl_mask, 0);
+
+            /* Enable the analog functionality on this pin */
+            Port_UpdateReg(&PORT_GPIO(gpio, AMSEL), Desc->bit, Desc->bit);
         }
-        else
+        else /* Another mode */
         {
-            /* Do Nothing ... No need to unlock the commit register for this pin */
-        }
+            /* Disable the analog functionality and enable the alternative function of this pin */
+            Port_UpdateReg(&PORT_GPIO(gpio, AMSEL), Desc->bit, 0);
+            Port_UpdateReg(&PORT_GPIO(gpio, AFSEL), Desc->bit, Desc->bit);
 
-        for (i = 0; i < NUMBER_OF_MODES; i++)
-        {
-            if (Port_ConfigPtr->Pin[counter].mode == Port_AllowedModes[i])
-            {
-                b_AllowedModeMatched = TRUE;
-            }
-        }
+            /* Set the PMCx bits for this pin, replacing the previous alternative function */
+            Port_UpdateReg(&PORT_GPIO(gpio, PCTL), pctl_mask,
+                           ((uint32) Mode & 0x0000000F) << Desc->pctl_shift);
 
-        if (b_AllowedModeMatched == FALSE)
-        {
-            //#error "This mode cannot be selected for this pin"
+            /* Enable the digital functionality on this pin */
+            Port_UpdateReg(&PORT_GPIO(gpio, DEN), Desc->bit, Desc->bit);
         }
-        else if ((Port_ConfigPtr->Pin[counter].port_num == 2)
-                && (Port_ConfigPtr->Pin[counter].pin_num <= 3)) /* PC0 to PC3 */
+
+        if (Desc->commit != 0U)
         {
-            // #error "Cannot configure JTAG pins to a different mode"
+            Port_Relock(gpio, Desc->commit);
         }
-        else
-        {
-            if (Port_ConfigPtr->Pin[counter].mode == GPIO_MODE)
-            {
-                /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-
-                /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-
-                /* Clear the PMCx bits for this pin */
-                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                        + PORT_CTL_REG_OFFSET) &= ~(0x0000000F
-                        << (Port_ConfigPtr->Pin[counter].pin_num * 4));
-
-                /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-            }
-            else if (Port_ConfigPtr->Pin[counter].mode == ANALOG)
-            {
-                /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-
-                /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-
-                /* Clear the PMCx bits for this pin */
-                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                        + PORT_CTL_REG_OFFSET) &= ~(0x0000000F
-                        << (Port_ConfigPtr->Pin[counter].pin_num * 4));
-
-                /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-            }
-            else /* Another mode */
-            {
-                /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-
-                /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-
-                /* Set the PMCx bits for this pin */
-                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                        + PORT_CTL_REG_OFFSET) |=
-                        (Port_ConfigPtr->Pin[counter].mode
-                                & 0x0000000F
-                                        << (Port_ConfigPtr->Pin[counter].pin_num
-                                                * 4));
-
-                /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-            }
 
-        }
+        /* Keep the shadow used by Port_ApplyProfile in sync with the new mode */
+        Port_ShadowSetMode(&Port_Shadow[Desc->port_num], (Port_PinType)(Desc->pctl_shift / 4U), Mode);
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_CheckIntegrity
+ * Service ID: 0x06
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_OK if the checked registers match their configuration,
+ *                                E_NOT_OK if one of them was corrupted.
+ * Description: Function to compare the next PORT_INTEGRITY_REGS_PER_CALL registers with the
+ *              shadow, only the pins owned by the configuration are compared.
+ ************************************************************************************/
+#if (PORT_INTEGRITY_CHECK_API == STD_ON)
+Std_ReturnType Port_CheckIntegrity(void)
+{
+    Std_ReturnType ret = E_OK;
+    const Port_RegImageType *Shadow = NULL_PTR;
+    Port_GpioRegsType *gpio = NULL_PTR;
+    volatile uint32 *reg = NULL_PTR;
+    uint32 mask = 0;
+    uint32 expected = 0;
+    uint32 actual = 0;
+    uint8 checked = 0;
 
-        if (Port_ConfigPtr->Pin[counter].direction == PORT_PIN_OUT)
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_CHECK_INTEGRITY_SID,
+        PORT_E_UNINIT);
+        ret = E_NOT_OK;
+    }
+    else
+#endif
+#if (PORT_LOW_POWER_API == STD_ON)
+    /* The parked pins differ from the shadow on purpose, nothing to check until Port_ExitLowPower */
+    if (Port_LowPowerActive == TRUE)
+    {
+        /* Do Nothing */
+    }
+    else
+#endif
+    {
+        /* Fixed number of registers per call, whatever the number of corrupted ones */
+        for (checked = 0; checked < PORT_INTEGRITY_REGS_PER_CALL; checked++)
         {
-            /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
-                    Port_ConfigPtr->Pin[counter].pin_num);
+            Shadow = &Port_Shadow[Port_IntegrityPort];
 
-            if (Port_ConfigPtr->Pin[counter].initial_value
-                    == PORT_PIN_LEVEL_HIGH)
+            /* Skip the ports not configured, with a gated clock (their registers would fault)
+             * or with deferred pins not yet configured by Port_InitContinue */
+            if ((Shadow->mask != 0U)
+                    && ((SYSCTL_PRGPIO_REG & ((uint32) 1U << Port_IntegrityPort)) != 0U)
+                    && ((Port_InitPendingPorts & (1U << Port_IntegrityPort)) == 0U))
             {
-                /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
+                gpio = Port_GpioBlock[Port_IntegrityPort];
+                reg = Port_IntegrityRegister(gpio, Shadow, Port_IntegrityReg, &expected);
+                mask = (Port_IntegrityReg == PORT_INTEGRITY_PCTL_REG) ? Port_PctlMask(Shadow->mask) : Shadow->mask;
+                actual = *reg & mask;
+
+                if (actual != expected)
+                {
+                    ret = E_NOT_OK;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+                    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_CHECK_INTEGRITY_SID,
+                    PORT_E_REGISTER_CORRUPTED);
+#endif
+
+#if (PORT_INTEGRITY_REPAIR == STD_ON)
+                    if (Shadow->commit != 0U)
+                    {
+                        Port_Unlock(gpio, Shadow->commit);
+                    }
+                    Port_UpdateReg(reg, mask, expected);
+                    if (Shadow->commit != 0U)
+                    {
+                        Port_Relock(gpio, Shadow->commit);
+                    }
+#endif
+                }
             }
-            else
+
+            /* Move to the next register, then to the next port */
+            Port_IntegrityReg++;
+            if (Port_IntegrityReg >= PORT_INTEGRITY_NUMBER_OF_REGS)
             {
-                /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
+                Port_IntegrityReg = 0;
+                Port_IntegrityPort++;
+                if (Port_IntegrityPort >= PORT_NUMBER_OF_PORTS)
+                {
+                    Port_IntegrityPort = 0;
+                }
             }
         }
-        else if (Port_ConfigPtr->Pin[counter].direction == PORT_PIN_IN)
-        {
-            /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-            CLEAR_BIT(
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
-                    Port_ConfigPtr->Pin[counter].pin_num);
+    }
 
-            if (Port_ConfigPtr->Pin[counter].resistor == PULL_UP)
-            {
-                /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-            }
-            else if (Port_ConfigPtr->Pin[counter].resistor == PULL_DOWN)
-            {
-                /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-            }
-            else
+    return ret;
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_ApplyProfile
+ * Service ID: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): ProfileId - ID of the pin-configuration profile
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to switch the pins of a profile to their configuration, only the
+ *              registers and ports that differ from the shadow are written.
+ ************************************************************************************/
+void Port_ApplyProfile(Port_ProfileIdType ProfileId)
+{
+    /* Loop counter to switch the ports one by one */
+    Port_PortType port = 0;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_APPLY_PROFILE_SID,
+        PORT_E_UNINIT);
+    }
+    /* check if incorrect profile ID passed */
+    else if (ProfileId >= PORT_NUMBER_OF_PROFILES)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_APPLY_PROFILE_SID,
+        PORT_E_PARAM_PROFILE);
+    }
+    else
+#endif
+    {
+        for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+        {
+            if (Port_ConfigPtr->ProfileImages[ProfileId][port].mask != 0U)
             {
-                /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-
-                /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
+                Port_ApplyImageDiff(port, &Port_ConfigPtr->ProfileImages[ProfileId][port]);
             }
         }
-        else
-        {
-            /* Do Nothing */
-        }
     }
 }
 
 /************************************************************************************
- * Service Name: Port_SetPinDirection
- * Service ID: 0x01
+ * Service Name: Port_EnterLowPower
+ * Service ID: 0x07
  * Sync/Async: Synchronous
- * Reentrancy: reentrant
- * Parameters (in): Pin - Port Pin ID number , Direction - Port Pin Direction
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to Sets the port pin direction.
+ * Description: Function to switch the parked pins to their low power state and gate the
+ *              clock of the ports with no live pin. The shadow keeps the configuration.
  ************************************************************************************/
-#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
-void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
+#if (PORT_LOW_POWER_API == STD_ON)
+void Port_EnterLowPower(void)
 {
+    /* Loop counter to park the ports one by one */
+    Port_PortType port = 0;
+
+    /* Parked pins of the port */
+    const Port_ParkImageType *Parking = NULL_PTR;
+    uint8 parked = 0;
+
+    /* Low power image of the port, the shadow with the parked pins overridden */
+    Port_RegImageType Image;
+    uint8 keep = 0;
+
+    uint32 gated = 0;
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* Check if the Driver is initialized before using this function */
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID,
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_ENTER_LOW_POWER_SID,
         PORT_E_UNINIT);
     }
     else
-    { /* Do Nothing */
-    }
-
-    /* check if incorrect Port Pin ID passed */
-    if (Pin >= PORT_NUMBER_OF_PORT_PINS)
+#endif
+    if (Port_LowPowerActive == FALSE)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID,
-        PORT_E_PARAM_PIN);
-    }
-    else
-    { /* Do Nothing */
-    }
+        for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+        {
+            if (Port_Shadow[port].mask == 0U)
+            {
+                /* Do Nothing ... port not configured and not clocked */
+                continue;
+            }
 
-    /* check if Port Pin not configured as changeable */
-    if (Port_ConfigPtr->Pin[Pin].pin_dir_changeable == STD_OFF)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID,
-        PORT_E_DIRECTION_UNCHANGEABLE);
-    }
-    else
-    { /* Do Nothing */
-    }
-#endif
+            Parking = &Port_ConfigPtr->Parking[port];
+            /* Only the pins in the shadow, the deferred pins not yet configured are left as they are */
+            parked = (Parking->analog | Parking->pull_down | Parking->pull_up) & Port_Shadow[port].mask;
 
-    volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+            /* Current output levels, written back unchanged with the low power image */
+            Port_LowPowerData[port] = (uint8) PORT_GPIO(Port_GpioBlock[port], DATA[PORT_DATA_ALL_PINS]);
 
-    switch (Port_ConfigPtr->Pin[Pin].port_num)
-    {
-    case 0:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-        break;
-    case 1:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-        break;
-    case 2:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-        break;
-    case 3:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-        break;
-    case 4:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-        break;
-    case 5:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-        break;
-    }
+            if (parked != 0U)
+            {
+                keep = (uint8) ~parked;
+                Image = Port_Shadow[port];
+                Image.dir &= keep;
+                Image.den &= keep;
+                Image.afsel &= keep;
+                Image.amsel = (Image.amsel & keep) | (Parking->analog & parked);
+                Image.pdr = (Image.pdr & keep) | (Parking->pull_down & parked);
+                Image.pur = (Image.pur & keep) | (Parking->pull_up & parked);
+                Image.pctl &= ~Port_PctlMask(parked);
+                Image.data = Port_LowPowerData[port];
+
+                Port_ApplyImage(port, &Image);
+            }
 
-    if ((Port_ConfigPtr->Pin[Pin].port_num == 2)
-            && (Port_ConfigPtr->Pin[Pin].pin_num <= 3)) /* PC0 to PC3 */
-    {
-        /* Do Nothing ...  this is the JTAG pins */
-        return;
-    }
+            /* All the pins of the port parked (PORTC keeps the JTAG pins live) */
+            if ((Port_PortPinsMask[port] & (uint8) ~parked) == 0U)
+            {
+                gated |= (uint32) 1U << port;
+            }
+        }
 
-    if (Direction == PORT_PIN_OUT)
-    {
-        /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
-                Port_ConfigPtr->Pin[Pin].pin_num);
-    }
-    else if (Direction == PORT_PIN_IN)
-    {
-        /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-        CLEAR_BIT(
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
-                Port_ConfigPtr->Pin[Pin].pin_num);
+        /* Gate the clocks of the ports with no live pin with one write */
+        Port_UpdateReg(&SYSCTL_RCGCGPIO_REG, gated, 0);
+        Port_GatedPorts = gated;
+        Port_LowPowerActive = TRUE;
     }
     else
-    { /* Do Nothing */
+    {
+        /* Do Nothing ... already in low power */
     }
 }
-#endif
 
 /************************************************************************************
- * Service Name: Port_RefreshPortDirection
- * Service ID: 0x02
+ * Service Name: Port_ExitLowPower
+ * Service ID: 0x08
  * Sync/Async: Synchronous
  * Reentrancy: Non reentrant
  * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Refreshes port direction.
+ * Description: Function to enable the gated clocks and write back the shadow of each port,
+ *              the parked output pins get their level saved by Port_EnterLowPower.
  ************************************************************************************/
-void Port_RefreshPortDirection(void)
+void Port_ExitLowPower(void)
 {
-    Port_PinType counter = 0;
+    /* Loop counter to restore the ports one by one */
+    Port_PortType port = 0;
+
+    /* Configuration image of the port with the output levels to restore */
+    Port_RegImageType Image;
+    uint8 live = 0;
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* Check if the Driver is initialized before using this function */
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-        PORT_REFRESH_PORT_DIR_SID,
-                        PORT_E_UNINIT);
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_EXIT_LOW_POWER_SID,
+        PORT_E_UNINIT);
     }
     else
-    { /* Do Nothing */
-    }
 #endif
-
-    for (counter = 0; counter < PORT_NUMBER_OF_PORT_PINS; counter++)
+    if (Port_LowPowerActive == TRUE)
     {
-        volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+        /* Enable the gated clocks with one write and wait once for all of them to be ready */
+        Port_UpdateReg(&SYSCTL_RCGCGPIO_REG, Port_GatedPorts, Port_GatedPorts);
+        while ((SYSCTL_PRGPIO_REG & Port_GatedPorts) != Port_GatedPorts);
 
-        switch (Port_ConfigPtr->Pin[counter].port_num)
+        for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
         {
-        case 0:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-            break;
-        case 1:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-            break;
-        case 2:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-            break;
-        case 3:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-            break;
-        case 4:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-            break;
-        case 5:
-            PortGpio_Ptr = (volatile uint32*) GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-            break;
-        }
+            if (Port_Shadow[port].mask != 0U)
+            {
+                /* The live pins keep the levels written while in low power */
+                live = (uint8) ~(Port_ConfigPtr->Parking[port].analog | Port_ConfigPtr->Parking[port].pull_down
+                        | Port_ConfigPtr->Parking[port].pull_up);
 
-        if ((Port_ConfigPtr->Pin[counter].port_num == 2)
-                && (Port_ConfigPtr->Pin[counter].pin_num <= 3)) /* PC0 to PC3 */
-        {
-            /* Do Nothing ...  JTAG pins */
-            continue;
-        }
+                Image = Port_Shadow[port];
+                Image.data = (uint8)((PORT_GPIO(Port_GpioBlock[port], DATA[PORT_DATA_ALL_PINS]) & live)
+                        | (Port_LowPowerData[port] & (uint8) ~live));
 
-        /* PORT061: The function Port_RefreshPortDirection shall exclude those port pins from
-         * refreshing that are configured as pin direction changeable during runtime */
-        if (Port_ConfigPtr->Pin[counter].pin_dir_changeable == STD_OFF)
-        {
-            if (Port_ConfigPtr->Pin[counter].direction == PORT_PIN_OUT)
-            {
-                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
-            }
-            else if (Port_ConfigPtr->Pin[counter].direction == PORT_PIN_IN)
-            {
-                /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                CLEAR_BIT(
-                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
-                        Port_ConfigPtr->Pin[counter].pin_num);
+                Port_ApplyImage(port, &Image);
             }
-            else
-            { /* Do Nothing */
-            }
-        }
-        else
-        { /* Do Nothing */
         }
+
+        Port_GatedPorts = 0;
+        Port_LowPowerActive = FALSE;
+    }
+    else
+    {
+        /* Do Nothing ... not in low power */
     }
 }
+#endif
 
 /************************************************************************************
- * Service Name: Port_GetVersionInfo
- * Service ID: 0x03
+ * Service Name: Port_GetConfigSetId
  * Sync/Async: Synchronous
  * Reentrancy: Non reentrant
  * Parameters (in): None
  * Parameters (inout): None
- * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
- * Return value: None
- * Description: Returns the version information of this module.
+ * Parameters (out): None
+ * Return value: Port_ConfigSetIdType - ID of the configuration set of the board variant
+ * Description: Function to read the strap pins as inputs with the internal pull-downs.
  ************************************************************************************/
-#if (PORT_VERSION_INFO_API == STD_ON)
-void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
+Port_ConfigSetIdType Port_GetConfigSetId(void)
 {
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* check if the input configuration pointer is not a NULL_PTR */
-    if (versioninfo == NULL_PTR)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-        PORT_GET_VERSION_INFO_SID,
-                        PORT_E_PARAM_POINTER);
-    }
-    else
-    { /* Do Nothing */
-    }
+    Port_GpioRegsType *gpio = Port_GpioBlock[PORT_VARIANT_STRAP_PORT];
+    uint32 straps = 0;
+    uint8 read = 0;
 
-    /* Check if the Driver is initialized before using this function */
-    if (Port_Status == PORT_NOT_INITIALIZED)
+    /* Enable clock for the strap PORT and wait for clock to start */
+    Port_UpdateReg(&SYSCTL_RCGCGPIO_REG, (uint32) 1U << PORT_VARIANT_STRAP_PORT, (uint32) 1U << PORT_VARIANT_STRAP_PORT);
+    while ((SYSCTL_PRGPIO_REG & ((uint32) 1U << PORT_VARIANT_STRAP_PORT)) == 0U);
+
+    /* Digital inputs with the internal pull-downs, a strap resistor to VCC gives a 1 */
+    Port_UpdateReg(&PORT_GPIO(gpio, DIR), PORT_VARIANT_STRAP_MASK, 0);
+    Port_UpdateReg(&PORT_GPIO(gpio, PDR), PORT_VARIANT_STRAP_MASK, PORT_VARIANT_STRAP_MASK);
+    Port_UpdateReg(&PORT_GPIO(gpio, DEN), PORT_VARIANT_STRAP_MASK, PORT_VARIANT_STRAP_MASK);
+
+    /* The last of the reads is used, the first ones only give time to the pull-downs */
+    for (read = 0; read < PORT_VARIANT_STRAP_SETTLE_READS; read++)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-        PORT_GET_VERSION_INFO_SID,
-                        PORT_E_UNINIT);
-    }
-    else
-    { /* Do Nothing */
+        straps = PORT_GPIO(gpio, DATA[PORT_VARIANT_STRAP_MASK]);
     }
-#endif
 
-    /* Copy the module Id */
-    versioninfo->moduleID = (uint16) PORT_MODULE_ID;
-    /* Copy the vendor Id */
-    versioninfo->vendorID = (uint16) PORT_VENDOR_ID;
-    /* Copy Software Major Version */
-    versioninfo->sw_major_version = (uint8) PORT_SW_MAJOR_VERSION;
-    /* Copy Software Minor Version */
-    versioninfo->sw_minor_version = (uint8) PORT_SW_MINOR_VERSION;
-    /* Copy Software Patch Version */
-    versioninfo->sw_patch_version = (uint8) PORT_SW_PATCH_VERSION;
+    straps = straps >> PORT_VARIANT_STRAP_SHIFT;
+
+    return (straps < PORT_NUMBER_OF_CONFIG_SETS) ? (Port_ConfigSetIdType) straps : PORT_DEFAULT_CONFIG_SET_ID;
 }
-#endif
 
 /************************************************************************************
- * Service Name: Port_SetPinMode
- * Service ID: 0x04
+ * Service Name: Port_GetPinState
+ * Service ID: 0x0C
  * Sync/Async: Synchronous
  * Reentrancy: reentrant
- * Parameters (in): Pin - Port Pin ID number, Mode - New Port Pin mode to be set on port pin
+ * Parameters (in): Pin - Port Pin ID number
  * Parameters (inout): None
- * Parameters (out): None
+ * Parameters (out): State - State of the pin read from the GPIO registers
  * Return value: None
- * Description: Sets the port pin mode.
+ * Description: Function to read the effective configuration and level of a pin.
  ************************************************************************************/
-#if (PORT_SET_PIN_MODE_API == STD_ON)
-void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+#if (PORT_PIN_STATE_API == STD_ON)
+void Port_GetPinState(Port_PinType Pin, Port_PinStateType *State)
 {
-    boolean b_AllowedModeMatched = FALSE;
+    Port_PinStateType States[PORT_NUMBER_OF_PINS_PER_PORT];
+    Port_PortType port = 0;
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* Check if the Driver is initialized before using this function */
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_PIN_STATE_SID,
         PORT_E_UNINIT);
     }
-    else
-    {
-        /* Do Nothing */
-    }
-
     /* check if incorrect Port Pin ID passed */
-    if (Pin >= PORT_NUMBER_OF_PORT_PINS)
+    else if (Pin >= PORT_NUMBER_OF_PORT_PINS)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_PIN_STATE_SID,
         PORT_E_PARAM_PIN);
     }
-    else
-    {
-        /* Do Nothing */
-    }
-
-    /* check if the API called when the mode is unchangeable */
-    if (Port_ConfigPtr->Pin[Pin].pin_mode_changeable == STD_OFF)
+    /* check if the output pointer is not a NULL_PTR */
+    else if (State == NULL_PTR)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
-        PORT_E_MODE_UNCHANGEABLE);
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_PIN_STATE_SID,
+        PORT_E_PARAM_POINTER);
     }
     else
-    {
-        /* Do Nothing */
-    }
 #endif
-
-    volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-
-    /* Index to be used with Port_AllowedModes[i] */
-    uint8 i = 0;
-
-
-    /* Assure that the Port_AllowedModes[i] container is cleared */
-    for (i = 0; i < NUMBER_OF_MODES; i++)
     {
-        Port_AllowedModes[i] = GPIO_MODE;
-    }
-    /* Clear the array index for next use */
-    i = 0;
+        port = Port_ConfigPtr->Pin[Pin].port_num;
 
-    switch (Port_ConfigPtr->Pin[Pin].port_num) /* get the corresponding port number */
-    {
-    case 0:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-        switch (Port_ConfigPtr->Pin[Pin].pin_num) /* get the corresponding pin number */
-        {
-        /* add the allowed mode to the Port_AllowedModes[] array */
-        case 0:
-        case 1:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT8;
-            break;
-        case 2:
-        case 3:
-        case 4:
-        case 5:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT2;
-            break;
-        case 6:
-        case 7:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT3;
-            Port_AllowedModes[2] = ALT5;
-            break;
-        }
-        break;
-    case 1:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-        switch (Port_ConfigPtr->Pin[Pin].pin_num)
-        {
-        case 0:
-        case 1:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT7;
-            Port_AllowedModes[3] = ANALOG;
-            break;
-        case 2:
-        case 3:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT3;
-            Port_AllowedModes[2] = ALT7;
-            break;
-        case 4:
-        case 5:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT2;
-            Port_AllowedModes[2] = ALT4;
-            Port_AllowedModes[3] = ALT7;
-            Port_AllowedModes[4] = ALT8;
-            Port_AllowedModes[5] = ANALOG;
-            break;
-        case 6:
-        case 7:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT2;
-            Port_AllowedModes[2] = ALT4;
-            Port_AllowedModes[3] = ALT7;
-            break;
-        }
-        break;
-    case 2:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-        switch (Port_ConfigPtr->Pin[Pin].pin_num)
-        {
-        case 0:
-        case 1:
-        case 2:
-        case 3:
-            break;
-        case 4:
-        case 5:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT2;
-            Port_AllowedModes[3] = ALT4;
-            Port_AllowedModes[4] = ALT6;
-            Port_AllowedModes[5] = ALT7;
-            Port_AllowedModes[6] = ALT8;
-            Port_AllowedModes[7] = ANALOG;
-            break;
-        case 6:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT6;
-            Port_AllowedModes[3] = ALT7;
-            Port_AllowedModes[4] = ALT8;
-            Port_AllowedModes[5] = ANALOG;
-            break;
-        case 7:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT7;
-            Port_AllowedModes[3] = ALT8;
-            Port_AllowedModes[4] = ANALOG;
-            break;
-        }
-        break;
-    case 3:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-        switch (Port_ConfigPtr->Pin[Pin].pin_num)
-        {
-        case 0:
-        case 1:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT2;
-            Port_AllowedModes[3] = ALT3;
-            Port_AllowedModes[4] = ALT4;
-            Port_AllowedModes[5] = ALT5;
-            Port_AllowedModes[6] = ALT7;
-            Port_AllowedModes[7] = ANALOG;
-            break;
-        case 2:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT2;
-            Port_AllowedModes[3] = ALT4;
-            Port_AllowedModes[4] = ALT7;
-            Port_AllowedModes[5] = ALT8;
-            Port_AllowedModes[6] = ANALOG;
-            break;
-        case 3:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT2;
-            Port_AllowedModes[3] = ALT6;
-            Port_AllowedModes[4] = ALT7;
-            Port_AllowedModes[5] = ALT8;
-            Port_AllowedModes[6] = ANALOG;
-            break;
-        case 4:
-        case 5:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT7;
-            Port_AllowedModes[3] = ANALOG;
-            break;
-        case 6:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT4;
-            Port_AllowedModes[3] = ALT6;
-            Port_AllowedModes[4] = ALT7;
-            break;
-        case 7:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT6;
-            Port_AllowedModes[3] = ALT7;
-            Port_AllowedModes[4] = ALT8;
-            break;
-        }
-        break;
-    case 4:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-        switch (Port_ConfigPtr->Pin[Pin].pin_num)
+        /* The registers of a gated port are not accessible */
+        if ((SYSCTL_PRGPIO_REG & ((uint32) 1U << port)) == 0U)
         {
-        case 0:
-        case 1:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ANALOG;
-            break;
-        case 2:
-        case 3:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ANALOG;
-            break;
-        case 4:
-        case 5:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT3;
-            Port_AllowedModes[3] = ALT4;
-            Port_AllowedModes[4] = ALT5;
-            Port_AllowedModes[5] = ALT8;
-            Port_AllowedModes[6] = ANALOG;
-            break;
+            *State = PORT_PIN_STATE_GATED;
         }
-        break;
-    case 5:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-        switch (Port_ConfigPtr->Pin[Pin].pin_num)
+        else
         {
-        case 0:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT2;
-            Port_AllowedModes[3] = ALT3;
-            Port_AllowedModes[4] = ALT5;
-            Port_AllowedModes[5] = ALT6;
-            Port_AllowedModes[6] = ALT7;
-            Port_AllowedModes[7] = ALT8;
-            Port_AllowedModes[8] = ALT9;
-            break;
-        case 1:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT1;
-            Port_AllowedModes[2] = ALT2;
-            Port_AllowedModes[3] = ALT5;
-            Port_AllowedModes[4] = ALT6;
-            Port_AllowedModes[5] = ALT7;
-            Port_AllowedModes[6] = ALT9;
-            Port_AllowedModes[7] = ALT10;
-            break;
-        case 2:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT2;
-            Port_AllowedModes[2] = ALT4;
-            Port_AllowedModes[3] = ALT5;
-            Port_AllowedModes[4] = ALT7;
-            Port_AllowedModes[5] = ALT10;
-            break;
-        case 3:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT2;
-            Port_AllowedModes[2] = ALT3;
-            Port_AllowedModes[3] = ALT5;
-            Port_AllowedModes[4] = ALT7;
-            Port_AllowedModes[5] = ALT10;
-            break;
-        case 4:
-            Port_AllowedModes[0] = GPIO_MODE;
-            Port_AllowedModes[1] = ALT5;
-            Port_AllowedModes[2] = ALT6;
-            Port_AllowedModes[3] = ALT7;
-            Port_AllowedModes[4] = ALT8;
-            break;
+            Port_ReadPortStates(port, States);
+            *State = States[Port_ConfigPtr->Pin[Pin].pin_num];
         }
-        break;
     }
+}
+
+/************************************************************************************
+ * Service Name: Port_DumpAll
+ * Service ID: 0x0D
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Buffer - PORT_DUMP_SIZE pins states, indexed by port * 8 + pin
+ * Return value: None
+ * Description: Function to read the state of every pin of the chip, the registers of
+ *              each port are read once (PRGPIO + 8 reads per port).
+ ************************************************************************************/
+void Port_DumpAll(Port_PinStateType *Buffer)
+{
+    uint32 ready = 0;
+    Port_PortType port = 0;
+    uint8 pin = 0;
 
-    if ((Port_ConfigPtr->Pin[Pin].port_num == 2)
-            && (Port_ConfigPtr->Pin[Pin].pin_num <= 3)) /* PC0 to PC3 */
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the output pointer is not a NULL_PTR */
+    if (Buffer == NULL_PTR)
     {
-        /* Do Nothing ...  this is the JTAG pins */
-        return;
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_DUMP_ALL_SID,
+        PORT_E_PARAM_POINTER);
     }
-
-    /* Check if the specified mode is applicable to the selected pin */
-    for (i = 0; i < NUMBER_OF_MODES; i++)
+    else
+#endif
     {
-        if (Port_ConfigPtr->Pin[Pin].mode == Port_AllowedModes[i])
+        ready = SYSCTL_PRGPIO_REG;
+
+        for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
         {
-            b_AllowedModeMatched = TRUE;
+            if ((ready & ((uint32) 1U << port)) == 0U)
+            {
+                /* The registers of a gated port are not accessible */
+                for (pin = 0; pin < PORT_NUMBER_OF_PINS_PER_PORT; pin++)
+                {
+                    Buffer[(port * PORT_NUMBER_OF_PINS_PER_PORT) + pin] = PORT_PIN_STATE_GATED;
+                }
+            }
+            else
+            {
+                Port_ReadPortStates(port, &Buffer[port * PORT_NUMBER_OF_PINS_PER_PORT]);
+            }
         }
     }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_GetInitTiming
+ * Service ID: 0x0B
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): PhaseCycles - Cycles of each Port_InitPhaseType phase
+ * Return value: None
+ * Description: Function to get the cycles of each phase of the last Port_Init/Port_InitPins.
+ ************************************************************************************/
+#if (PORT_INIT_TIMING == STD_ON)
+void Port_GetInitTiming(uint32 *PhaseCycles)
+{
+    uint8 phase = 0;
 
-    if (b_AllowedModeMatched == FALSE)
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the output pointer is not a NULL_PTR */
+    if (PhaseCycles == NULL_PTR)
     {
-        /* Report a Det error if the mode is inapplicable to the specified pin */
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
-        PORT_E_PARAM_INVALID_MODE);
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_INIT_TIMING_SID,
+        PORT_E_PARAM_POINTER);
     }
     else
+#endif
     {
-
-        if (Mode == GPIO_MODE)
-        {
-            /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            CLEAR_BIT(
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
-
-            /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            CLEAR_BIT(
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
-
-            /* Clear the PMCx bits for this pin */
-            *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                    + PORT_CTL_REG_OFFSET) &= ~(0x0000000F
-                    << (Port_ConfigPtr->Pin[Pin].pin_num * 4));
-
-            /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
-        }
-        else if (Mode == ANALOG)
-        {
-            /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-            CLEAR_BIT(
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
-
-            /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            CLEAR_BIT(
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
-
-            /* Clear the PMCx bits for this pin */
-            *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                    + PORT_CTL_REG_OFFSET) &= ~(0x0000000F
-                    << (Port_ConfigPtr->Pin[Pin].pin_num * 4));
-
-            /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
-        }
-        else /* Another mode */
+        for (phase = 0; phase < PORT_INIT_NUMBER_OF_PHASES; phase++)
         {
-            /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            CLEAR_BIT(
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
-
-            /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
-
-            /* Set the PMCx bits for this pin */
-            *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                    + PORT_CTL_REG_OFFSET) |= (Mode
-                    & 0x0000000F << (Port_ConfigPtr->Pin[Pin].pin_num * 4));
-
-            /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
-                    Port_ConfigPtr->Pin[Pin].pin_num);
+            PhaseCycles[phase] = Port_InitPhaseCycles[phase];
         }
     }
 }
@@ -34,6 +34,9 @@
 
 #include "Port_Reg.h"
 
+/* Signals of the pins, named by PORT_PIN_CONFIG_MUX and PORT_MUX_MODE */
+#include "Port_PinMux.h"
+
 #include "Common_Macros.h"
 
 /*******************************************************************************
@@ -60,14 +63,29 @@
 /* APIs called with a Null Pointer */
 #define PORT_E_PARAM_POINTER                (uint8)0x10
 
+/* API Port_ApplyProfile service called with an invalid profile ID */
+#define PORT_E_PARAM_PROFILE                (uint8)0x11
+
+/* API Port_CheckIntegrity service found a GPIO register different from its configuration */
+#define PORT_E_REGISTER_CORRUPTED           (uint8)0x12
+
 
 
 /* Array of Port_ConfigPin */
 typedef struct
 {
     Port_ConfigPin Pin[PORT_NUMBER_OF_PORT_PINS];
+    const Port_RegImageType *Images; /* Registers images of each port, generated from Pin[] by Tools/PortCfgGen */
+    const Port_ProfileConfigType *Profiles; /* Pins of each profile */
+    const Port_RegImageType (*ProfileImages)[PORT_NUMBER_OF_PORTS]; /* Registers images of each profile, generated from Profiles[] */
+    const Port_ParkImageType *Parking; /* Low power state of the pins of each port, generated from Pin[] */
+    const Port_RegImageType *CriticalImages; /* Registers images of the PORT_PIN_INIT_CRITICAL pins, generated from Pin[] */
+    const Port_PinDescType *PinDesc; /* Resolved registers of each pin of Pin[] for the runtime services */
 }Port_ConfigType;
 
+/* Number of records written by Port_DumpAll, one per pin of each port (unbonded pins included) */
+#define PORT_DUMP_SIZE              (PORT_NUMBER_OF_PORTS * PORT_NUMBER_OF_PINS_PER_PORT)
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -80,13 +98,52 @@ typedef struct
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Initializes the Port Driver module.
+* Description: Initializes the Port Driver module. Only the PORT_PIN_INIT_CRITICAL pins
+*              are configured, the other pins are configured by Port_InitContinue.
 ************************************************************************************/
 void Port_Init (
                  const Port_ConfigType* ConfigPtr
                 )
 ;
 
+/************************************************************************************
+* Service Name: Port_InitContinue
+* Service ID: 0x0A
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when all the pins of the configuration are configured,
+*                         FALSE while deferred pins are still pending.
+* Description: Configures the deferred pins of the next pending port, called from a
+*              periodic task after Port_Init until it returns TRUE.
+************************************************************************************/
+boolean Port_InitContinue(
+        void
+        )
+;
+
+/************************************************************************************
+* Service Name: Port_InitPins
+* Service ID: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): Pins - Pointer to the pins to configure
+*                  NumberOfPins - Number of pins in Pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Configures only the given pins, the registers of each port are written
+*              once for all its pins and the other pins of the port are not changed.
+*              Used by the modules bringing up their own pins (Led, Button).
+************************************************************************************/
+void Port_InitPins(
+        const Port_ConfigPin* Pins,
+        uint8 NumberOfPins
+        )
+;
+
 #if (PORT_SET_PIN_DIRECTION_API == STD_ON)
 /************************************************************************************
 * Service Name: Port_SetPinDirection
@@ -167,11 +224,181 @@ void Port_SetPinMode(
 #endif
 
 
+/************************************************************************************
+* Service Name: Port_ApplyProfile
+* Service ID: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): ProfileId - ID of the pin-configuration profile
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Switches the pins of a profile to their configuration. Only the registers
+*              and ports that differ from the current configuration are written.
+************************************************************************************/
+void Port_ApplyProfile(
+        Port_ProfileIdType ProfileId
+        )
+;
+
+#if (PORT_INTEGRITY_CHECK_API == STD_ON)
+/************************************************************************************
+* Service Name: Port_CheckIntegrity
+* Service ID: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the checked registers match their configuration,
+*                                E_NOT_OK if one of them was corrupted.
+* Description: Compares the next PORT_INTEGRITY_REGS_PER_CALL GPIO registers with the
+*              expected configuration and repairs (PORT_INTEGRITY_REPAIR) and reports
+*              the corrupted ones. Consecutive calls scan all the ports in turn.
+************************************************************************************/
+Std_ReturnType Port_CheckIntegrity(
+        void
+        )
+;
+#endif
+
+#if (PORT_LOW_POWER_API == STD_ON)
+/************************************************************************************
+* Service Name: Port_EnterLowPower
+* Service ID: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Switches the pins configured with a park state to it and gates the clock
+*              of the ports left with no live pin. The other pins keep their configuration.
+************************************************************************************/
+void Port_EnterLowPower(
+        void
+        )
+;
+
+/************************************************************************************
+* Service Name: Port_ExitLowPower
+* Service ID: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Enables the gated ports clocks and restores the configuration and the
+*              output levels saved by Port_EnterLowPower, one image write per port.
+************************************************************************************/
+void Port_ExitLowPower(
+        void
+        )
+;
+#endif
+
+/************************************************************************************
+* Service Name: Port_GetConfigSetId
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Port_ConfigSetIdType - ID of the configuration set of the board variant
+* Description: Reads the strap pins with their internal pull-downs, to be called at boot
+*              before Port_Init(Port_ConfigSets[Port_GetConfigSetId()]). An unknown ID gives
+*              PORT_DEFAULT_CONFIG_SET_ID. Port_Init then configures the strap pins as any other.
+************************************************************************************/
+Port_ConfigSetIdType Port_GetConfigSetId(
+        void
+        )
+;
+
+#if (PORT_PIN_STATE_API == STD_ON)
+/************************************************************************************
+* Service Name: Port_GetPinState
+* Service ID: 0x0C
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Pin - Port Pin ID number
+* Parameters (inout): None
+* Parameters (out): State - State of the pin read from the GPIO registers
+* Return value: None
+* Description: Reads the effective configuration and level of a pin from the hardware.
+************************************************************************************/
+void Port_GetPinState(
+        Port_PinType Pin,
+        Port_PinStateType *State
+        )
+;
+
+/************************************************************************************
+* Service Name: Port_DumpAll
+* Service ID: 0x0D
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Buffer - State of every pin of the chip indexed by
+*                            (port * PORT_NUMBER_OF_PINS_PER_PORT + pin), PORT_DUMP_SIZE records
+* Return value: None
+* Description: Reads the registers of each port once and decodes the states of its 8 pins,
+*              49 register reads for the whole chip.
+************************************************************************************/
+void Port_DumpAll(
+        Port_PinStateType *Buffer
+        )
+;
+#endif
+
+#if (PORT_INIT_TIMING == STD_ON)
+/************************************************************************************
+* Service Name: Port_GetInitTiming
+* Service ID: 0x0B
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): PhaseCycles - Cycles of each Port_InitPhaseType phase
+* Return value: None
+* Description: Gives the cycles spent in each phase by the last Port_Init or Port_InitPins,
+*              summed over the written ports.
+************************************************************************************/
+void Port_GetInitTiming(
+        uint32 *PhaseCycles
+        )
+;
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
 
-/* Post build structure used with Port_Init API */
+/* Post build structures used with Port_Init API, one per board variant */
 extern const Port_ConfigType Port_PinConfig;
+extern const Port_ConfigType Port_PinConfigRgbLed;
+
+/* Post build structures indexed by the configuration set ID */
+extern const Port_ConfigType * const Port_ConfigSets[PORT_NUMBER_OF_CONFIG_SETS];
+
+/* Registers images of each port of each configuration set (Port_PBimage.c) */
+extern const Port_RegImageType Port_ConfigSetImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+
+/* Registers images of each profile of each configuration set (Port_PBimage.c) */
+extern const Port_RegImageType Port_ConfigSetProfileImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PROFILES][PORT_NUMBER_OF_PORTS];
+
+/* Low power state of the pins of each port of each configuration set (Port_PBimage.c) */
+extern const Port_ParkImageType Port_ConfigSetParking[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+
+/* Registers images of the critical pins of each port of each configuration set (Port_PBimage.c) */
+extern const Port_RegImageType Port_ConfigSetCriticalImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+
+/* Resolved registers of each pin of each configuration set (Port_PBimage.c) */
+extern const Port_PinDescType Port_ConfigSetPinDesc[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORT_PINS];
+
+/* Set the bits of a pin in the registers image of its port (Port_Image.c), shared by
+ * Port_InitPins and Tools/PortCfgGen */
+void Port_AddPinToImage(const Port_ConfigPin *PinConfig, Port_RegImageType *Image);
 
 #endif /* PORT_H */
@@ -49,6 +49,50 @@
  */
 #define PORT_VERSION_INFO_API                 (STD_ON)
 
+/*
+ * Enable/Disable the background check of the GPIO registers (Port_CheckIntegrity)
+ */
+#define PORT_INTEGRITY_CHECK_API              (STD_ON)
+
+/*
+ * Number of registers compared by each Port_CheckIntegrity call, there are
+ * 12 registers per port (mode, pulls and the 5 pad registers) so 12 checks one
+ * port per call and a full scan of the 6 ports takes 6 calls (120ms from the
+ * 20ms Os slot)
+ */
+#define PORT_INTEGRITY_REGS_PER_CALL          (12U)
+
+/*
+ * Enable/Disable writing back the expected value of a corrupted register,
+ * when disabled the divergence is only reported
+ */
+#define PORT_INTEGRITY_REPAIR                 (STD_ON)
+
+/*
+ * Enable/Disable parking the pins and gating the ports clocks in low power
+ */
+#define PORT_LOW_POWER_API                    (STD_ON)
+
+/*
+ * Enable/Disable reading back the pins states (Port_GetPinState, Port_DumpAll)
+ */
+#define PORT_PIN_STATE_API                    (STD_ON)
+
+/*
+ * Enable/Disable counting the cycles of each phase of Port_Init and Port_InitPins
+ * (DWT cycle counter), read with Port_GetInitTiming. Can also be enabled from the
+ * build command line (-DPORT_INIT_TIMING=STD_ON) as done by Tools/PortBench.
+ */
+#ifndef PORT_INIT_TIMING
+#define PORT_INIT_TIMING                      (STD_OFF)
+#endif
+
+/*
+ * Enable/Disable the configuration of the commit-protected pins PD7 and PF0, when
+ * disabled they are reserved like the JTAG pins and never written by the driver
+ */
+#define PORT_UNLOCK_LOCKED_PINS               (STD_ON)
+
 /* Number of configured PINS */
 #define PORT_NUMBER_OF_PORT_PINS              (43U)
 
@@ -70,5 +114,37 @@
 #define PORT_Pin6                   (6U)
 #define PORT_Pin7                   (7U)
 
+/* Number of Target HW Ports and maximum number of pins in a port */
+#define PORT_NUMBER_OF_PORTS        (6U)
+#define PORT_NUMBER_OF_PINS_PER_PORT (8U)
+
+/* Number of post-build configuration sets, one per board variant */
+#define PORT_NUMBER_OF_CONFIG_SETS            (2U)
+
+/* Configuration sets IDs, the value of the strap pins of each board variant */
+#define PortConf_CONFIG_SET_LAUNCHPAD_ID      (Port_ConfigSetIdType)0 /* Port_PinConfig */
+#define PortConf_CONFIG_SET_RGB_LED_ID        (Port_ConfigSetIdType)1 /* Port_PinConfigRgbLed */
+
+/*
+ * Strap pins giving the board variant, read with the internal pull-downs by
+ * Port_GetConfigSetId: PE0 is the bit 0 of the configuration set ID
+ */
+#define PORT_VARIANT_STRAP_PORT               PORT_PortE
+#define PORT_VARIANT_STRAP_MASK               (0x01U)
+#define PORT_VARIANT_STRAP_SHIFT              (0U)
+
+/* Number of reads of the strap pins to let the pull-downs settle */
+#define PORT_VARIANT_STRAP_SETTLE_READS       (16U)
+
+/* Configuration set used when the strap pins give an unknown ID */
+#define PORT_DEFAULT_CONFIG_SET_ID            PortConf_CONFIG_SET_LAUNCHPAD_ID
+
+/* Number of configured pin-configuration profiles */
+#define PORT_NUMBER_OF_PROFILES               (2U)
+
+/* Profiles IDs used with Port_ApplyProfile */
+#define PortConf_PROFILE_UART0_ID             (Port_ProfileIdType)0 /* PA0/PA1 as U0Rx/U0Tx */
+#define PortConf_PROFILE_UART0_GPIO_ID        (Port_ProfileIdType)1 /* PA0/PA1 as GPIO handshake lines */
+
 
 #endif /* PORT_CFG_H_ */
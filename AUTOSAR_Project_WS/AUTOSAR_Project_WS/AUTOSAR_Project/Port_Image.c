@@ -0,0 +1,98 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Image.c
+ *
+ * Description: Encoding of the pins configuration into the registers images of
+ *              the Port Driver. Used at run time by Port_InitPins (Port.c) and
+ *              on the host by Tools/PortCfgGen to generate Port_PBimage.c, so
+ *              both give the same images.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include "Port.h"
+
+/************************************************************************************
+ * Description: Set the bits of a pin in the registers image of its port.
+ ************************************************************************************/
+void Port_AddPinToImage(const Port_ConfigPin *PinConfig, Port_RegImageType *Image)
+{
+    uint8 bit = (uint8)(1U << PinConfig->pin_num);
+
+    Image->mask |= bit;
+
+    if (PORT_PIN_IS_LOCKED(PinConfig->port_num, PinConfig->pin_num))
+    {
+        /* The pin has to be unlocked in the GPIOCR register before its configuration */
+        Image->commit |= bit;
+    }
+
+    if (PinConfig->pin_dir_changeable == STD_OFF)
+    {
+        /* Direction restored by Port_RefreshPortDirection */
+        Image->dir_refresh |= bit;
+    }
+
+    if (PinConfig->mode == GPIO_MODE)
+    {
+        Image->den |= bit;
+    }
+    else if (PinConfig->mode == ANALOG)
+    {
+        Image->amsel |= bit;
+    }
+    else /* Another mode */
+    {
+        Image->afsel |= bit;
+        Image->den |= bit;
+        Image->pctl |= ((uint32) PinConfig->mode & 0x0000000F) << (PinConfig->pin_num * 4);
+    }
+
+    if (PinConfig->direction == PORT_PIN_OUT)
+    {
+        Image->dir |= bit;
+
+        if (PinConfig->initial_value == PORT_PIN_LEVEL_HIGH)
+        {
+            Image->data |= bit;
+        }
+    }
+    else if (PinConfig->resistor == PULL_UP)
+    {
+        Image->pur |= bit;
+    }
+    else if (PinConfig->resistor == PULL_DOWN)
+    {
+        Image->pdr |= bit;
+    }
+    else
+    {
+        /* Do Nothing ... internal resistors disabled */
+    }
+
+    /* Drive strength, one of the three drive registers per pin */
+    if (PinConfig->drive == PORT_PIN_DRIVE_4MA)
+    {
+        Image->dr4r |= bit;
+    }
+    else if ((PinConfig->drive == PORT_PIN_DRIVE_8MA) || (PinConfig->drive == PORT_PIN_DRIVE_8MA_SLEW))
+    {
+        Image->dr8r |= bit;
+
+        if (PinConfig->drive == PORT_PIN_DRIVE_8MA_SLEW)
+        {
+            Image->slr |= bit;
+        }
+    }
+    else
+    {
+        Image->dr2r |= bit;
+    }
+
+    if (PinConfig->open_drain == STD_ON)
+    {
+        Image->odr |= bit;
+    }
+}
@@ -39,58 +39,156 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
-/* PB structure used with Port_Init API */
+/*
+ * The pins are listed with PORT_PIN_CONFIG so an invalid mode, a configured JTAG pin or
+ * a locked pin (PD7/PF0) without PORT_UNLOCK_LOCKED_PINS fails the compilation. The pins
+ * of a peripheral are listed with PORT_PIN_CONFIG_MUX and the signal name (Port_PinMux.h).
+ */
+
+/* Profile PortConf_PROFILE_UART0_ID: boot-loader UART on PA0 (U0Rx) and PA1 (U0Tx) */
+STATIC const Port_ConfigPin Port_ProfileUart0Pins[] = {
+        PORT_PIN_CONFIG_MUX(PA0_U0RX, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG_MUX(PA1_U0TX, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF)
+};
+
+/* Profile PortConf_PROFILE_UART0_GPIO_ID: handshake lines on PA0 (request in) and PA1 (ready out) */
+STATIC const Port_ConfigPin Port_ProfileUart0GpioPins[] = {
+        PORT_PIN_CONFIG(A, 0, PORT_PIN_IN, PULL_UP, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 1, PORT_PIN_OUT, OFF, GPIO_MODE, PORT_PIN_LEVEL_HIGH, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF)
+};
+
+STATIC const Port_ProfileConfigType Port_Profiles[PORT_NUMBER_OF_PROFILES] = {
+        { Port_ProfileUart0Pins, (uint8)(sizeof(Port_ProfileUart0Pins) / sizeof(Port_ConfigPin)) },
+        { Port_ProfileUart0GpioPins, (uint8)(sizeof(Port_ProfileUart0GpioPins) / sizeof(Port_ConfigPin)) }
+};
+
+/* PB structure used with Port_Init API, configuration set of the LaunchPad board (straps open),
+ * the red LED (PF1) and the encoder phases (PD2, PD3) sampled by Qdec_Init are configured
+ * by Port_Init and the other pins by Port_InitContinue */
 const Port_ConfigType Port_PinConfig = {
-        PORT_PortA , PORT_Pin0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortA , PORT_Pin1, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortA , PORT_Pin2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortA , PORT_Pin3, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortA , PORT_Pin4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortA , PORT_Pin5, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortA , PORT_Pin6, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortA , PORT_Pin7, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-
-        PORT_PortB , PORT_Pin0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortB , PORT_Pin1, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortB , PORT_Pin2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortB , PORT_Pin3, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortB , PORT_Pin4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortB , PORT_Pin5, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortB , PORT_Pin6, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortB , PORT_Pin7, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-
-        PORT_PortC , PORT_Pin0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortC , PORT_Pin1, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortC , PORT_Pin2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortC , PORT_Pin3, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortC , PORT_Pin4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortC , PORT_Pin5, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortC , PORT_Pin6, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortC , PORT_Pin7, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-
-        PORT_PortD , PORT_Pin0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortD , PORT_Pin1, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortD , PORT_Pin2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortD , PORT_Pin3, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortD , PORT_Pin4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortD , PORT_Pin5, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortD , PORT_Pin6, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortD , PORT_Pin7, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-
-        PORT_PortE , PORT_Pin0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortE , PORT_Pin1, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortE , PORT_Pin2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortE , PORT_Pin3, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortE , PORT_Pin4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortE , PORT_Pin5, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-
-        PORT_PortF , PORT_Pin0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW , GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortF , PORT_Pin1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortF , PORT_Pin2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortF , PORT_Pin3, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE , STD_ON, STD_ON,
-        PORT_PortF , PORT_Pin4, PORT_PIN_IN, PULL_UP, PORT_PIN_LEVEL_LOW,  GPIO_MODE , STD_ON, STD_ON
+    {
+        PORT_PIN_CONFIG(A, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 6, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 7, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+
+        PORT_PIN_CONFIG(B, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 6, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 7, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
 
+        PORT_PIN_CONFIG(C, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_OFF, STD_OFF, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_OFF, STD_OFF, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_OFF, STD_OFF, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_OFF, STD_OFF, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 6, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 7, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+
+        PORT_PIN_CONFIG(D, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_CRITICAL, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_CRITICAL, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 6, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 7, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+
+        PORT_PIN_CONFIG(E, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+
+        PORT_PIN_CONFIG(F, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(F, 1, PORT_PIN_OUT, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_CRITICAL, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(F, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(F, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(F, 4, PORT_PIN_IN, PULL_UP, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF)
+    },
+    Port_ConfigSetImages[PortConf_CONFIG_SET_LAUNCHPAD_ID],
+    Port_Profiles,
+    Port_ConfigSetProfileImages[PortConf_CONFIG_SET_LAUNCHPAD_ID],
+    Port_ConfigSetParking[PortConf_CONFIG_SET_LAUNCHPAD_ID],
+    Port_ConfigSetCriticalImages[PortConf_CONFIG_SET_LAUNCHPAD_ID],
+    Port_ConfigSetPinDesc[PortConf_CONFIG_SET_LAUNCHPAD_ID]
 };
 
+/* PB structure used with Port_Init API, configuration set of the RGB LED board (PE0 strap pulled up),
+ * the blue (PF2) and green (PF3) LEDs are outputs kept live in low power, the LEDs are
+ * configured by Port_Init with the 8-mA drive, the encoder phases (PD2, PD3) sampled by
+ * Qdec_Init are configured by Port_Init and the other pins by Port_InitContinue */
+const Port_ConfigType Port_PinConfigRgbLed = {
+    {
+        PORT_PIN_CONFIG(A, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 6, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(A, 7, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+
+        PORT_PIN_CONFIG(B, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 6, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(B, 7, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+
+        PORT_PIN_CONFIG(C, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_OFF, STD_OFF, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_OFF, STD_OFF, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_OFF, STD_OFF, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_OFF, STD_OFF, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 6, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(C, 7, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
 
+        PORT_PIN_CONFIG(D, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_CRITICAL, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_CRITICAL, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 6, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(D, 7, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
 
+        PORT_PIN_CONFIG(E, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 1, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 2, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 3, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 4, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(E, 5, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_ANALOG, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+
+        PORT_PIN_CONFIG(F, 0, PORT_PIN_IN, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF),
+        PORT_PIN_CONFIG(F, 1, PORT_PIN_OUT, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_CRITICAL, PORT_PIN_DRIVE_8MA, STD_OFF),
+        PORT_PIN_CONFIG(F, 2, PORT_PIN_OUT, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_CRITICAL, PORT_PIN_DRIVE_8MA, STD_OFF),
+        PORT_PIN_CONFIG(F, 3, PORT_PIN_OUT, OFF, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_CRITICAL, PORT_PIN_DRIVE_8MA, STD_OFF),
+        PORT_PIN_CONFIG(F, 4, PORT_PIN_IN, PULL_UP, GPIO_MODE, PORT_PIN_LEVEL_LOW, STD_ON, STD_ON, PORT_PIN_PARK_NONE, PORT_PIN_INIT_DEFERRED, PORT_PIN_DRIVE_2MA, STD_OFF)
+    },
+    Port_ConfigSetImages[PortConf_CONFIG_SET_RGB_LED_ID],
+    Port_Profiles,
+    Port_ConfigSetProfileImages[PortConf_CONFIG_SET_RGB_LED_ID],
+    Port_ConfigSetParking[PortConf_CONFIG_SET_RGB_LED_ID],
+    Port_ConfigSetCriticalImages[PortConf_CONFIG_SET_RGB_LED_ID],
+    Port_ConfigSetPinDesc[PortConf_CONFIG_SET_RGB_LED_ID]
+};
+
+/* Configuration sets indexed by the variant ID read from the strap pins (Port_GetConfigSetId) */
+const Port_ConfigType * const Port_ConfigSets[PORT_NUMBER_OF_CONFIG_SETS] = {
+        &Port_PinConfig,
+        &Port_PinConfigRgbLed
+};
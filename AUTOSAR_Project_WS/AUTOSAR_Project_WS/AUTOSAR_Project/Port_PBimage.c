@@ -0,0 +1,274 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PBimage.c
+ *
+ * Description: Registers images of the configuration sets for TM4C123GH6PM Microcontroller - Port Driver
+ *              GENERATED by Tools/PortCfgGen from Port_PBcfg.c, do not edit.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include "Port.h"
+
+/* mask, dir, data, den, afsel, amsel, pur, pdr, commit, dir_refresh, dr2r, dr4r, dr8r, slr, odr, pctl */
+const Port_RegImageType Port_ConfigSetImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS] =
+{
+    /* Configuration set 0 */
+    {
+        /* PORTA */
+        { 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTB */
+        { 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTC */
+        { 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTD */
+        { 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTE */
+        { 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTF */
+        { 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00000000U }
+    },
+    /* Configuration set 1 */
+    {
+        /* PORTA */
+        { 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTB */
+        { 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTC */
+        { 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTD */
+        { 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTE */
+        { 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTF */
+        { 0x1F, 0x0E, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x00, 0x00000000U }
+    }
+};
+
+/* Pins of each profile only, the mask selects the pins switched by Port_ApplyProfile */
+const Port_RegImageType Port_ConfigSetProfileImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PROFILES][PORT_NUMBER_OF_PORTS] =
+{
+    /* Configuration set 0 */
+    {
+        /* Profile 0 */
+        {
+            /* PORTA */
+            { 0x03, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00000011U },
+            /* PORTB */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTC */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTD */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTE */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTF */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U }
+        },
+        /* Profile 1 */
+        {
+            /* PORTA */
+            { 0x03, 0x02, 0x02, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTB */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTC */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTD */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTE */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTF */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U }
+        }
+    },
+    /* Configuration set 1 */
+    {
+        /* Profile 0 */
+        {
+            /* PORTA */
+            { 0x03, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00000011U },
+            /* PORTB */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTC */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTD */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTE */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTF */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U }
+        },
+        /* Profile 1 */
+        {
+            /* PORTA */
+            { 0x03, 0x02, 0x02, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTB */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTC */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTD */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTE */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+            /* PORTF */
+            { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U }
+        }
+    }
+};
+
+/* analog, pull_down, pull_up */
+const Port_ParkImageType Port_ConfigSetParking[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS] =
+{
+    /* Configuration set 0 */
+    {
+        { 0x00, 0xFF, 0x00 }, /* PORTA */
+        { 0x33, 0xCC, 0x00 }, /* PORTB */
+        { 0xF0, 0x00, 0x00 }, /* PORTC */
+        { 0x33, 0xC0, 0x00 }, /* PORTD */
+        { 0x3F, 0x00, 0x00 }, /* PORTE */
+        { 0x00, 0x0D, 0x00 }  /* PORTF */
+    },
+    /* Configuration set 1 */
+    {
+        { 0x00, 0xFF, 0x00 }, /* PORTA */
+        { 0x33, 0xCC, 0x00 }, /* PORTB */
+        { 0xF0, 0x00, 0x00 }, /* PORTC */
+        { 0x33, 0xC0, 0x00 }, /* PORTD */
+        { 0x3F, 0x00, 0x00 }, /* PORTE */
+        { 0x00, 0x01, 0x00 }  /* PORTF */
+    }
+};
+
+/* PORT_PIN_INIT_CRITICAL pins only, written by Port_Init */
+const Port_RegImageType Port_ConfigSetCriticalImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS] =
+{
+    /* Configuration set 0 */
+    {
+        /* PORTA */
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTB */
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTC */
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTD */
+        { 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTE */
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTF */
+        { 0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00000000U }
+    },
+    /* Configuration set 1 */
+    {
+        /* PORTA */
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTB */
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTC */
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTD */
+        { 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTE */
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000U },
+        /* PORTF */
+        { 0x0E, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00000000U }
+    }
+};
+
+/* base, allowed_modes, port_num, bit, pctl_shift, commit */
+const Port_PinDescType Port_ConfigSetPinDesc[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORT_PINS] =
+{
+    /* Configuration set 0 */
+    {
+        { 0x40004000U, 0x00103U, 0, 0x01,  0, 0x00 }, /*  0 PA0 */
+        { 0x40004000U, 0x00103U, 0, 0x02,  4, 0x00 }, /*  1 PA1 */
+        { 0x40004000U, 0x00005U, 0, 0x04,  8, 0x00 }, /*  2 PA2 */
+        { 0x40004000U, 0x00005U, 0, 0x08, 12, 0x00 }, /*  3 PA3 */
+        { 0x40004000U, 0x00005U, 0, 0x10, 16, 0x00 }, /*  4 PA4 */
+        { 0x40004000U, 0x00005U, 0, 0x20, 20, 0x00 }, /*  5 PA5 */
+        { 0x40004000U, 0x00029U, 0, 0x40, 24, 0x00 }, /*  6 PA6 */
+        { 0x40004000U, 0x00029U, 0, 0x80, 28, 0x00 }, /*  7 PA7 */
+        { 0x40005000U, 0x10083U, 1, 0x01,  0, 0x00 }, /*  8 PB0 */
+        { 0x40005000U, 0x10083U, 1, 0x02,  4, 0x00 }, /*  9 PB1 */
+        { 0x40005000U, 0x00089U, 1, 0x04,  8, 0x00 }, /* 10 PB2 */
+        { 0x40005000U, 0x00089U, 1, 0x08, 12, 0x00 }, /* 11 PB3 */
+        { 0x40005000U, 0x10195U, 1, 0x10, 16, 0x00 }, /* 12 PB4 */
+        { 0x40005000U, 0x10195U, 1, 0x20, 20, 0x00 }, /* 13 PB5 */
+        { 0x40005000U, 0x00095U, 1, 0x40, 24, 0x00 }, /* 14 PB6 */
+        { 0x40005000U, 0x00095U, 1, 0x80, 28, 0x00 }, /* 15 PB7 */
+        { 0x40006000U, 0x00000U, 2, 0x01,  0, 0x00 }, /* 16 PC0 */
+        { 0x40006000U, 0x00000U, 2, 0x02,  4, 0x00 }, /* 17 PC1 */
+        { 0x40006000U, 0x00000U, 2, 0x04,  8, 0x00 }, /* 18 PC2 */
+        { 0x40006000U, 0x00000U, 2, 0x08, 12, 0x00 }, /* 19 PC3 */
+        { 0x40006000U, 0x101D7U, 2, 0x10, 16, 0x00 }, /* 20 PC4 */
+        { 0x40006000U, 0x101D7U, 2, 0x20, 20, 0x00 }, /* 21 PC5 */
+        { 0x40006000U, 0x101C3U, 2, 0x40, 24, 0x00 }, /* 22 PC6 */
+        { 0x40006000U, 0x10183U, 2, 0x80, 28, 0x00 }, /* 23 PC7 */
+        { 0x40007000U, 0x100BFU, 3, 0x01,  0, 0x00 }, /* 24 PD0 */
+        { 0x40007000U, 0x100BFU, 3, 0x02,  4, 0x00 }, /* 25 PD1 */
+        { 0x40007000U, 0x10197U, 3, 0x04,  8, 0x00 }, /* 26 PD2 */
+        { 0x40007000U, 0x101C7U, 3, 0x08, 12, 0x00 }, /* 27 PD3 */
+        { 0x40007000U, 0x10083U, 3, 0x10, 16, 0x00 }, /* 28 PD4 */
+        { 0x40007000U, 0x10083U, 3, 0x20, 20, 0x00 }, /* 29 PD5 */
+        { 0x40007000U, 0x000D3U, 3, 0x40, 24, 0x00 }, /* 30 PD6 */
+        { 0x40007000U, 0x001C3U, 3, 0x80, 28, 0x80 }, /* 31 PD7 */
+        { 0x40024000U, 0x10003U, 4, 0x01,  0, 0x00 }, /* 32 PE0 */
+        { 0x40024000U, 0x10003U, 4, 0x02,  4, 0x00 }, /* 33 PE1 */
+        { 0x40024000U, 0x10001U, 4, 0x04,  8, 0x00 }, /* 34 PE2 */
+        { 0x40024000U, 0x10001U, 4, 0x08, 12, 0x00 }, /* 35 PE3 */
+        { 0x40024000U, 0x1013BU, 4, 0x10, 16, 0x00 }, /* 36 PE4 */
+        { 0x40024000U, 0x1013BU, 4, 0x20, 20, 0x00 }, /* 37 PE5 */
+        { 0x40025000U, 0x003EFU, 5, 0x01,  0, 0x01 }, /* 38 PF0 */
+        { 0x40025000U, 0x042E7U, 5, 0x02,  4, 0x00 }, /* 39 PF1 */
+        { 0x40025000U, 0x040B5U, 5, 0x04,  8, 0x00 }, /* 40 PF2 */
+        { 0x40025000U, 0x040ADU, 5, 0x08, 12, 0x00 }, /* 41 PF3 */
+        { 0x40025000U, 0x001E1U, 5, 0x10, 16, 0x00 }  /* 42 PF4 */
+    },
+    /* Configuration set 1 */
+    {
+        { 0x40004000U, 0x00103U, 0, 0x01,  0, 0x00 }, /*  0 PA0 */
+        { 0x40004000U, 0x00103U, 0, 0x02,  4, 0x00 }, /*  1 PA1 */
+        { 0x40004000U, 0x00005U, 0, 0x04,  8, 0x00 }, /*  2 PA2 */
+        { 0x40004000U, 0x00005U, 0, 0x08, 12, 0x00 }, /*  3 PA3 */
+        { 0x40004000U, 0x00005U, 0, 0x10, 16, 0x00 }, /*  4 PA4 */
+        { 0x40004000U, 0x00005U, 0, 0x20, 20, 0x00 }, /*  5 PA5 */
+        { 0x40004000U, 0x00029U, 0, 0x40, 24, 0x00 }, /*  6 PA6 */
+        { 0x40004000U, 0x00029U, 0, 0x80, 28, 0x00 }, /*  7 PA7 */
+        { 0x40005000U, 0x10083U, 1, 0x01,  0, 0x00 }, /*  8 PB0 */
+        { 0x40005000U, 0x10083U, 1, 0x02,  4, 0x00 }, /*  9 PB1 */
+        { 0x40005000U, 0x00089U, 1, 0x04,  8, 0x00 }, /* 10 PB2 */
+        { 0x40005000U, 0x00089U, 1, 0x08, 12, 0x00 }, /* 11 PB3 */
+        { 0x40005000U, 0x10195U, 1, 0x10, 16, 0x00 }, /* 12 PB4 */
+        { 0x40005000U, 0x10195U, 1, 0x20, 20, 0x00 }, /* 13 PB5 */
+        { 0x40005000U, 0x00095U, 1, 0x40, 24, 0x00 }, /* 14 PB6 */
+        { 0x40005000U, 0x00095U, 1, 0x80, 28, 0x00 }, /* 15 PB7 */
+        { 0x40006000U, 0x00000U, 2, 0x01,  0, 0x00 }, /* 16 PC0 */
+        { 0x40006000U, 0x00000U, 2, 0x02,  4, 0x00 }, /* 17 PC1 */
+        { 0x40006000U, 0x00000U, 2, 0x04,  8, 0x00 }, /* 18 PC2 */
+        { 0x40006000U, 0x00000U, 2, 0x08, 12, 0x00 }, /* 19 PC3 */
+        { 0x40006000U, 0x101D7U, 2, 0x10, 16, 0x00 }, /* 20 PC4 */
+        { 0x40006000U, 0x101D7U, 2, 0x20, 20, 0x00 }, /* 21 PC5 */
+        { 0x40006000U, 0x101C3U, 2, 0x40, 24, 0x00 }, /* 22 PC6 */
+        { 0x40006000U, 0x10183U, 2, 0x80, 28, 0x00 }, /* 23 PC7 */
+        { 0x40007000U, 0x100BFU, 3, 0x01,  0, 0x00 }, /* 24 PD0 */
+        { 0x40007000U, 0x100BFU, 3, 0x02,  4, 0x00 }, /* 25 PD1 */
+        { 0x40007000U, 0x10197U, 3, 0x04,  8, 0x00 }, /* 26 PD2 */
+        { 0x40007000U, 0x101C7U, 3, 0x08, 12, 0x00 }, /* 27 PD3 */
+        { 0x40007000U, 0x10083U, 3, 0x10, 16, 0x00 }, /* 28 PD4 */
+        { 0x40007000U, 0x10083U, 3, 0x20, 20, 0x00 }, /* 29 PD5 */
+        { 0x40007000U, 0x000D3U, 3, 0x40, 24, 0x00 }, /* 30 PD6 */
+        { 0x40007000U, 0x001C3U, 3, 0x80, 28, 0x80 }, /* 31 PD7 */
+        { 0x40024000U, 0x10003U, 4, 0x01,  0, 0x00 }, /* 32 PE0 */
+        { 0x40024000U, 0x10003U, 4, 0x02,  4, 0x00 }, /* 33 PE1 */
+        { 0x40024000U, 0x10001U, 4, 0x04,  8, 0x00 }, /* 34 PE2 */
+        { 0x40024000U, 0x10001U, 4, 0x08, 12, 0x00 }, /* 35 PE3 */
+        { 0x40024000U, 0x1013BU, 4, 0x10, 16, 0x00 }, /* 36 PE4 */
+        { 0x40024000U, 0x1013BU, 4, 0x20, 20, 0x00 }, /* 37 PE5 */
+        { 0x40025000U, 0x003EFU, 5, 0x01,  0, 0x01 }, /* 38 PF0 */
+        { 0x40025000U, 0x042E7U, 5, 0x02,  4, 0x00 }, /* 39 PF1 */
+        { 0x40025000U, 0x040B5U, 5, 0x04,  8, 0x00 }, /* 40 PF2 */
+        { 0x40025000U, 0x040ADU, 5, 0x08, 12, 0x00 }, /* 41 PF3 */
+        { 0x40025000U, 0x001E1U, 5, 0x10, 16, 0x00 }  /* 42 PF4 */
+    }
+};
@@ -0,0 +1,272 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PinMux.h
+ *
+ * Description: Pin-mux database for TM4C123GH6PM Microcontroller - Port Driver
+ *              GENERATED by Tools/PinMuxGen, do not edit.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef PORT_PINMUX_H_
+#define PORT_PINMUX_H_
+
+/*
+ * PORT_MUX_Pxn_SIGNAL is the port letter, the pin number and the mode of a signal on
+ * the pin Pxn, the low nibble of the mode is the PMCx value written in GPIOPCTL. Used
+ * through PORT_PIN_CONFIG_MUX and PORT_MUX_MODE (Port_Types.h), e.g. PA0_U0RX.
+ */
+#define PORT_MUX_PA0_U0RX                A, 0, ALT1
+#define PORT_MUX_PA0_CAN1RX              A, 0, ALT8
+#define PORT_MUX_PA1_U0TX                A, 1, ALT1
+#define PORT_MUX_PA1_CAN1TX              A, 1, ALT8
+#define PORT_MUX_PA2_SSI0CLK             A, 2, ALT2
+#define PORT_MUX_PA3_SSI0FSS             A, 3, ALT2
+#define PORT_MUX_PA4_SSI0RX              A, 4, ALT2
+#define PORT_MUX_PA5_SSI0TX              A, 5, ALT2
+#define PORT_MUX_PA6_I2C1SCL             A, 6, ALT3
+#define PORT_MUX_PA6_M1PWM2              A, 6, ALT5
+#define PORT_MUX_PA7_I2C1SDA             A, 7, ALT3
+#define PORT_MUX_PA7_M1PWM3              A, 7, ALT5
+
+#define PORT_MUX_PB0_USB0ID              B, 0, ANALOG
+#define PORT_MUX_PB0_U1RX                B, 0, ALT1
+#define PORT_MUX_PB0_T2CCP0              B, 0, ALT7
+#define PORT_MUX_PB1_USB0VBUS            B, 1, ANALOG
+#define PORT_MUX_PB1_U1TX                B, 1, ALT1
+#define PORT_MUX_PB1_T2CCP1              B, 1, ALT7
+#define PORT_MUX_PB2_I2C0SCL             B, 2, ALT3
+#define PORT_MUX_PB2_T3CCP0              B, 2, ALT7
+#define PORT_MUX_PB3_I2C0SDA             B, 3, ALT3
+#define PORT_MUX_PB3_T3CCP1              B, 3, ALT7
+#define PORT_MUX_PB4_AIN10               B, 4, ANALOG
+#define PORT_MUX_PB4_SSI2CLK             B, 4, ALT2
+#define PORT_MUX_PB4_M0PWM2              B, 4, ALT4
+#define PORT_MUX_PB4_T1CCP0              B, 4, ALT7
+#define PORT_MUX_PB4_CAN0RX              B, 4, ALT8
+#define PORT_MUX_PB5_AIN11               B, 5, ANALOG
+#define PORT_MUX_PB5_SSI2FSS             B, 5, ALT2
+#define PORT_MUX_PB5_M0PWM3              B, 5, ALT4
+#define PORT_MUX_PB5_T1CCP1              B, 5, ALT7
+#define PORT_MUX_PB5_CAN0TX              B, 5, ALT8
+#define PORT_MUX_PB6_SSI2RX              B, 6, ALT2
+#define PORT_MUX_PB6_M0PWM0              B, 6, ALT4
+#define PORT_MUX_PB6_T0CCP0              B, 6, ALT7
+#define PORT_MUX_PB7_SSI2TX              B, 7, ALT2
+#define PORT_MUX_PB7_M0PWM1              B, 7, ALT4
+#define PORT_MUX_PB7_T0CCP1              B, 7, ALT7
+
+#define PORT_MUX_PC4_C1M                 C, 4, ANALOG
+#define PORT_MUX_PC4_U4RX                C, 4, ALT1
+#define PORT_MUX_PC4_U1RX                C, 4, ALT2
+#define PORT_MUX_PC4_M0PWM6              C, 4, ALT4
+#define PORT_MUX_PC4_IDX1                C, 4, ALT6
+#define PORT_MUX_PC4_WT0CCP0             C, 4, ALT7
+#define PORT_MUX_PC4_U1RTS               C, 4, ALT8
+#define PORT_MUX_PC5_C1P                 C, 5, ANALOG
+#define PORT_MUX_PC5_U4TX                C, 5, ALT1
+#define PORT_MUX_PC5_U1TX                C, 5, ALT2
+#define PORT_MUX_PC5_M0PWM7              C, 5, ALT4
+#define PORT_MUX_PC5_PHA1                C, 5, ALT6
+#define PORT_MUX_PC5_WT0CCP1             C, 5, ALT7
+#define PORT_MUX_PC5_U1CTS               C, 5, ALT8
+#define PORT_MUX_PC6_C0P                 C, 6, ANALOG
+#define PORT_MUX_PC6_U3RX                C, 6, ALT1
+#define PORT_MUX_PC6_PHB1                C, 6, ALT6
+#define PORT_MUX_PC6_WT1CCP0             C, 6, ALT7
+#define PORT_MUX_PC6_USB0EPEN            C, 6, ALT8
+#define PORT_MUX_PC7_C0M                 C, 7, ANALOG
+#define PORT_MUX_PC7_U3TX                C, 7, ALT1
+#define PORT_MUX_PC7_WT1CCP1             C, 7, ALT7
+#define PORT_MUX_PC7_USB0PFLT            C, 7, ALT8
+
+#define PORT_MUX_PD0_AIN7                D, 0, ANALOG
+#define PORT_MUX_PD0_SSI3CLK             D, 0, ALT1
+#define PORT_MUX_PD0_SSI1CLK             D, 0, ALT2
+#define PORT_MUX_PD0_I2C3SCL             D, 0, ALT3
+#define PORT_MUX_PD0_M0PWM6              D, 0, ALT4
+#define PORT_MUX_PD0_M1PWM0              D, 0, ALT5
+#define PORT_MUX_PD0_WT2CCP0             D, 0, ALT7
+#define PORT_MUX_PD1_AIN6                D, 1, ANALOG
+#define PORT_MUX_PD1_SSI3FSS             D, 1, ALT1
+#define PORT_MUX_PD1_SSI1FSS             D, 1, ALT2
+#define PORT_MUX_PD1_I2C3SDA             D, 1, ALT3
+#define PORT_MUX_PD1_M0PWM7              D, 1, ALT4
+#define PORT_MUX_PD1_M1PWM1              D, 1, ALT5
+#define PORT_MUX_PD1_WT2CCP1             D, 1, ALT7
+#define PORT_MUX_PD2_AIN5                D, 2, ANALOG
+#define PORT_MUX_PD2_SSI3RX              D, 2, ALT1
+#define PORT_MUX_PD2_SSI1RX              D, 2, ALT2
+#define PORT_MUX_PD2_M0FAULT0            D, 2, ALT4
+#define PORT_MUX_PD2_WT3CCP0             D, 2, ALT7
+#define PORT_MUX_PD2_USB0EPEN            D, 2, ALT8
+#define PORT_MUX_PD3_AIN4                D, 3, ANALOG
+#define PORT_MUX_PD3_SSI3TX              D, 3, ALT1
+#define PORT_MUX_PD3_SSI1TX              D, 3, ALT2
+#define PORT_MUX_PD3_IDX0                D, 3, ALT6
+#define PORT_MUX_PD3_WT3CCP1             D, 3, ALT7
+#define PORT_MUX_PD3_USB0PFLT            D, 3, ALT8
+#define PORT_MUX_PD4_USB0DM              D, 4, ANALOG
+#define PORT_MUX_PD4_U6RX                D, 4, ALT1
+#define PORT_MUX_PD4_WT4CCP0             D, 4, ALT7
+#define PORT_MUX_PD5_USB0DP              D, 5, ANALOG
+#define PORT_MUX_PD5_U6TX                D, 5, ALT1
+#define PORT_MUX_PD5_WT4CCP1             D, 5, ALT7
+#define PORT_MUX_PD6_U2RX                D, 6, ALT1
+#define PORT_MUX_PD6_M0FAULT0            D, 6, ALT4
+#define PORT_MUX_PD6_PHA0                D, 6, ALT6
+#define PORT_MUX_PD6_WT5CCP0             D, 6, ALT7
+#define PORT_MUX_PD7_U2TX                D, 7, ALT1
+#define PORT_MUX_PD7_PHB0                D, 7, ALT6
+#define PORT_MUX_PD7_WT5CCP1             D, 7, ALT7
+#define PORT_MUX_PD7_NMI                 D, 7, ALT8
+
+#define PORT_MUX_PE0_AIN3                E, 0, ANALOG
+#define PORT_MUX_PE0_U7RX                E, 0, ALT1
+#define PORT_MUX_PE1_AIN2                E, 1, ANALOG
+#define PORT_MUX_PE1_U7TX                E, 1, ALT1
+#define PORT_MUX_PE2_AIN1                E, 2, ANALOG
+#define PORT_MUX_PE3_AIN0                E, 3, ANALOG
+#define PORT_MUX_PE4_AIN9                E, 4, ANALOG
+#define PORT_MUX_PE4_U5RX                E, 4, ALT1
+#define PORT_MUX_PE4_I2C2SCL             E, 4, ALT3
+#define PORT_MUX_PE4_M0PWM4              E, 4, ALT4
+#define PORT_MUX_PE4_M1PWM2              E, 4, ALT5
+#define PORT_MUX_PE4_CAN0RX              E, 4, ALT8
+#define PORT_MUX_PE5_AIN8                E, 5, ANALOG
+#define PORT_MUX_PE5_U5TX                E, 5, ALT1
+#define PORT_MUX_PE5_I2C2SDA             E, 5, ALT3
+#define PORT_MUX_PE5_M0PWM5              E, 5, ALT4
+#define PORT_MUX_PE5_M1PWM3              E, 5, ALT5
+#define PORT_MUX_PE5_CAN0TX              E, 5, ALT8
+
+#define PORT_MUX_PF0_U1RTS               F, 0, ALT1
+#define PORT_MUX_PF0_SSI1RX              F, 0, ALT2
+#define PORT_MUX_PF0_CAN0RX              F, 0, ALT3
+#define PORT_MUX_PF0_M1PWM4              F, 0, ALT5
+#define PORT_MUX_PF0_PHA0                F, 0, ALT6
+#define PORT_MUX_PF0_T0CCP0              F, 0, ALT7
+#define PORT_MUX_PF0_NMI                 F, 0, ALT8
+#define PORT_MUX_PF0_C0O                 F, 0, ALT9
+#define PORT_MUX_PF1_U1CTS               F, 1, ALT1
+#define PORT_MUX_PF1_SSI1TX              F, 1, ALT2
+#define PORT_MUX_PF1_M1PWM5              F, 1, ALT5
+#define PORT_MUX_PF1_PHB0                F, 1, ALT6
+#define PORT_MUX_PF1_T0CCP1              F, 1, ALT7
+#define PORT_MUX_PF1_C1O                 F, 1, ALT9
+#define PORT_MUX_PF1_TRD1                F, 1, ALT10
+#define PORT_MUX_PF2_SSI1CLK             F, 2, ALT2
+#define PORT_MUX_PF2_M0FAULT0            F, 2, ALT4
+#define PORT_MUX_PF2_M1PWM6              F, 2, ALT5
+#define PORT_MUX_PF2_T1CCP0              F, 2, ALT7
+#define PORT_MUX_PF2_TRD0                F, 2, ALT10
+#define PORT_MUX_PF3_SSI1FSS             F, 3, ALT2
+#define PORT_MUX_PF3_CAN0TX              F, 3, ALT3
+#define PORT_MUX_PF3_M1PWM7              F, 3, ALT5
+#define PORT_MUX_PF3_T1CCP1              F, 3, ALT7
+#define PORT_MUX_PF3_TRCLK               F, 3, ALT10
+#define PORT_MUX_PF4_M1FAULT0            F, 4, ALT5
+#define PORT_MUX_PF4_IDX0                F, 4, ALT6
+#define PORT_MUX_PF4_T2CCP0              F, 4, ALT7
+#define PORT_MUX_PF4_USB0EPEN            F, 4, ALT8
+
+/*
+ * Signals found on one pin only, named without the pin. The signals available on
+ * several pins (e.g. CAN0RX on PB4, PE4 and PF0) need the PORT_MUX_Pxn_SIGNAL name.
+ */
+#define PORT_MUX_U0RX                    PORT_MUX_PA0_U0RX
+#define PORT_MUX_CAN1RX                  PORT_MUX_PA0_CAN1RX
+#define PORT_MUX_U0TX                    PORT_MUX_PA1_U0TX
+#define PORT_MUX_CAN1TX                  PORT_MUX_PA1_CAN1TX
+#define PORT_MUX_SSI0CLK                 PORT_MUX_PA2_SSI0CLK
+#define PORT_MUX_SSI0FSS                 PORT_MUX_PA3_SSI0FSS
+#define PORT_MUX_SSI0RX                  PORT_MUX_PA4_SSI0RX
+#define PORT_MUX_SSI0TX                  PORT_MUX_PA5_SSI0TX
+#define PORT_MUX_I2C1SCL                 PORT_MUX_PA6_I2C1SCL
+#define PORT_MUX_I2C1SDA                 PORT_MUX_PA7_I2C1SDA
+#define PORT_MUX_USB0ID                  PORT_MUX_PB0_USB0ID
+#define PORT_MUX_USB0VBUS                PORT_MUX_PB1_USB0VBUS
+#define PORT_MUX_T2CCP1                  PORT_MUX_PB1_T2CCP1
+#define PORT_MUX_I2C0SCL                 PORT_MUX_PB2_I2C0SCL
+#define PORT_MUX_T3CCP0                  PORT_MUX_PB2_T3CCP0
+#define PORT_MUX_I2C0SDA                 PORT_MUX_PB3_I2C0SDA
+#define PORT_MUX_T3CCP1                  PORT_MUX_PB3_T3CCP1
+#define PORT_MUX_AIN10                   PORT_MUX_PB4_AIN10
+#define PORT_MUX_SSI2CLK                 PORT_MUX_PB4_SSI2CLK
+#define PORT_MUX_M0PWM2                  PORT_MUX_PB4_M0PWM2
+#define PORT_MUX_AIN11                   PORT_MUX_PB5_AIN11
+#define PORT_MUX_SSI2FSS                 PORT_MUX_PB5_SSI2FSS
+#define PORT_MUX_M0PWM3                  PORT_MUX_PB5_M0PWM3
+#define PORT_MUX_SSI2RX                  PORT_MUX_PB6_SSI2RX
+#define PORT_MUX_M0PWM0                  PORT_MUX_PB6_M0PWM0
+#define PORT_MUX_SSI2TX                  PORT_MUX_PB7_SSI2TX
+#define PORT_MUX_M0PWM1                  PORT_MUX_PB7_M0PWM1
+#define PORT_MUX_C1M                     PORT_MUX_PC4_C1M
+#define PORT_MUX_U4RX                    PORT_MUX_PC4_U4RX
+#define PORT_MUX_IDX1                    PORT_MUX_PC4_IDX1
+#define PORT_MUX_WT0CCP0                 PORT_MUX_PC4_WT0CCP0
+#define PORT_MUX_C1P                     PORT_MUX_PC5_C1P
+#define PORT_MUX_U4TX                    PORT_MUX_PC5_U4TX
+#define PORT_MUX_PHA1                    PORT_MUX_PC5_PHA1
+#define PORT_MUX_WT0CCP1                 PORT_MUX_PC5_WT0CCP1
+#define PORT_MUX_C0P                     PORT_MUX_PC6_C0P
+#define PORT_MUX_U3RX                    PORT_MUX_PC6_U3RX
+#define PORT_MUX_PHB1                    PORT_MUX_PC6_PHB1
+#define PORT_MUX_WT1CCP0                 PORT_MUX_PC6_WT1CCP0
+#define PORT_MUX_C0M                     PORT_MUX_PC7_C0M
+#define PORT_MUX_U3TX                    PORT_MUX_PC7_U3TX
+#define PORT_MUX_WT1CCP1                 PORT_MUX_PC7_WT1CCP1
+#define PORT_MUX_AIN7                    PORT_MUX_PD0_AIN7
+#define PORT_MUX_SSI3CLK                 PORT_MUX_PD0_SSI3CLK
+#define PORT_MUX_I2C3SCL                 PORT_MUX_PD0_I2C3SCL
+#define PORT_MUX_M1PWM0                  PORT_MUX_PD0_M1PWM0
+#define PORT_MUX_WT2CCP0                 PORT_MUX_PD0_WT2CCP0
+#define PORT_MUX_AIN6                    PORT_MUX_PD1_AIN6
+#define PORT_MUX_SSI3FSS                 PORT_MUX_PD1_SSI3FSS
+#define PORT_MUX_I2C3SDA                 PORT_MUX_PD1_I2C3SDA
+#define PORT_MUX_M1PWM1                  PORT_MUX_PD1_M1PWM1
+#define PORT_MUX_WT2CCP1                 PORT_MUX_PD1_WT2CCP1
+#define PORT_MUX_AIN5                    PORT_MUX_PD2_AIN5
+#define PORT_MUX_SSI3RX                  PORT_MUX_PD2_SSI3RX
+#define PORT_MUX_WT3CCP0                 PORT_MUX_PD2_WT3CCP0
+#define PORT_MUX_AIN4                    PORT_MUX_PD3_AIN4
+#define PORT_MUX_SSI3TX                  PORT_MUX_PD3_SSI3TX
+#define PORT_MUX_WT3CCP1                 PORT_MUX_PD3_WT3CCP1
+#define PORT_MUX_USB0DM                  PORT_MUX_PD4_USB0DM
+#define PORT_MUX_U6RX                    PORT_MUX_PD4_U6RX
+#define PORT_MUX_WT4CCP0                 PORT_MUX_PD4_WT4CCP0
+#define PORT_MUX_USB0DP                  PORT_MUX_PD5_USB0DP
+#define PORT_MUX_U6TX                    PORT_MUX_PD5_U6TX
+#define PORT_MUX_WT4CCP1                 PORT_MUX_PD5_WT4CCP1
+#define PORT_MUX_U2RX                    PORT_MUX_PD6_U2RX
+#define PORT_MUX_WT5CCP0                 PORT_MUX_PD6_WT5CCP0
+#define PORT_MUX_U2TX                    PORT_MUX_PD7_U2TX
+#define PORT_MUX_WT5CCP1                 PORT_MUX_PD7_WT5CCP1
+#define PORT_MUX_AIN3                    PORT_MUX_PE0_AIN3
+#define PORT_MUX_U7RX                    PORT_MUX_PE0_U7RX
+#define PORT_MUX_AIN2                    PORT_MUX_PE1_AIN2
+#define PORT_MUX_U7TX                    PORT_MUX_PE1_U7TX
+#define PORT_MUX_AIN1                    PORT_MUX_PE2_AIN1
+#define PORT_MUX_AIN0                    PORT_MUX_PE3_AIN0
+#define PORT_MUX_AIN9                    PORT_MUX_PE4_AIN9
+#define PORT_MUX_U5RX                    PORT_MUX_PE4_U5RX
+#define PORT_MUX_I2C2SCL                 PORT_MUX_PE4_I2C2SCL
+#define PORT_MUX_M0PWM4                  PORT_MUX_PE4_M0PWM4
+#define PORT_MUX_AIN8                    PORT_MUX_PE5_AIN8
+#define PORT_MUX_U5TX                    PORT_MUX_PE5_U5TX
+#define PORT_MUX_I2C2SDA                 PORT_MUX_PE5_I2C2SDA
+#define PORT_MUX_M0PWM5                  PORT_MUX_PE5_M0PWM5
+#define PORT_MUX_M1PWM4                  PORT_MUX_PF0_M1PWM4
+#define PORT_MUX_C0O                     PORT_MUX_PF0_C0O
+#define PORT_MUX_M1PWM5                  PORT_MUX_PF1_M1PWM5
+#define PORT_MUX_C1O                     PORT_MUX_PF1_C1O
+#define PORT_MUX_TRD1                    PORT_MUX_PF1_TRD1
+#define PORT_MUX_M1PWM6                  PORT_MUX_PF2_M1PWM6
+#define PORT_MUX_TRD0                    PORT_MUX_PF2_TRD0
+#define PORT_MUX_M1PWM7                  PORT_MUX_PF3_M1PWM7
+#define PORT_MUX_TRCLK                   PORT_MUX_PF3_TRCLK
+#define PORT_MUX_M1FAULT0                PORT_MUX_PF4_M1FAULT0
+
+#endif /* PORT_PINMUX_H_ */
@@ -12,6 +12,8 @@
 #ifndef PORT_REG_H_
 #define PORT_REG_H_
 
+#include "Std_Types.h"
+
 /*******************************************************************************
  *                              Module Registers Definitions                   *
  *******************************************************************************/
@@ -24,21 +26,83 @@
 #define GPIO_PORTE_BASE_ADDRESS           0x40024000
 #define GPIO_PORTF_BASE_ADDRESS           0x40025000
 
-/* GPIO Registers offset addresses */
-#define PORT_DATA_REG_OFFSET              0x3FC
-#define PORT_DIR_REG_OFFSET               0x400
-#define PORT_ALT_FUNC_REG_OFFSET          0x420
-#define PORT_PULL_UP_REG_OFFSET           0x510
-#define PORT_PULL_DOWN_REG_OFFSET         0x514
-#define PORT_DIGITAL_ENABLE_REG_OFFSET    0x51C
-#define PORT_LOCK_REG_OFFSET              0x520
-#define PORT_COMMIT_REG_OFFSET            0x524
-#define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
-#define PORT_CTL_REG_OFFSET               0x52C
-
-
-/* RCC Registers */
-#define SYSCTL_REGCGC2_REG              (*((volatile uint32 *)0x400FE108))
+/* GPIO register block of a port, the members are at the offsets of the datasheet */
+typedef struct
+{
+    volatile uint32 DATA[256];      /* 0x000 GPIODATA, bits [9:2] of the address mask the accessed pins */
+    volatile uint32 DIR;            /* 0x400 GPIODIR */
+    volatile uint32 IS;             /* 0x404 GPIOIS */
+    volatile uint32 IBE;            /* 0x408 GPIOIBE */
+    volatile uint32 IEV;            /* 0x40C GPIOIEV */
+    volatile uint32 IM;             /* 0x410 GPIOIM */
+    volatile uint32 RIS;            /* 0x414 GPIORIS */
+    volatile uint32 MIS;            /* 0x418 GPIOMIS */
+    volatile uint32 ICR;            /* 0x41C GPIOICR */
+    volatile uint32 AFSEL;          /* 0x420 GPIOAFSEL */
+    uint32 RESERVED0[55];           /* 0x424 - 0x4FC */
+    volatile uint32 DR2R;           /* 0x500 GPIODR2R */
+    volatile uint32 DR4R;           /* 0x504 GPIODR4R */
+    volatile uint32 DR8R;           /* 0x508 GPIODR8R */
+    volatile uint32 ODR;            /* 0x50C GPIOODR */
+    volatile uint32 PUR;            /* 0x510 GPIOPUR */
+    volatile uint32 PDR;            /* 0x514 GPIOPDR */
+    volatile uint32 SLR;            /* 0x518 GPIOSLR */
+    volatile uint32 DEN;            /* 0x51C GPIODEN */
+    volatile uint32 LOCK;           /* 0x520 GPIOLOCK */
+    volatile uint32 CR;             /* 0x524 GPIOCR */
+    volatile uint32 AMSEL;          /* 0x528 GPIOAMSEL */
+    volatile uint32 PCTL;           /* 0x52C GPIOPCTL */
+    volatile uint32 ADCCTL;         /* 0x530 GPIOADCCTL */
+    volatile uint32 DMACTL;         /* 0x534 GPIODMACTL */
+} Port_GpioRegsType;
+
+/* Index of GPIODATA giving all the pins of a port */
+#define PORT_DATA_ALL_PINS                0xFF
+
+/* Value written in GPIOLOCK to unlock the GPIOCR register */
+#define PORT_GPIO_LOCK_KEY                0x4C4F434B
+
+/* Any other value written in GPIOLOCK locks the GPIOCR register again */
+#define PORT_GPIO_RELOCK_VALUE            0x00000000
+
+/* GPIO register block of a port from its base address, and access to one of its registers
+ * (one base register and immediate offsets). The host tools (Tools/PortBench) may redirect
+ * both to simulated blocks counting the accesses */
+#ifndef PORT_GPIO_BLOCK
+#define PORT_GPIO_BLOCK(BASE)             ((Port_GpioRegsType *)(BASE))
+#endif
+
+#ifndef PORT_GPIO
+#define PORT_GPIO(GPIO, REG)              ((GPIO)->REG)
+#endif
+
+/*
+ * Initializer of a [port] table of the GPIO register blocks (ports A-F), used by the
+ * Port, Dio, Qdec and Ocu modules to reach a port from its number.
+ */
+#define PORT_GPIO_BLOCK_TABLE \
+{ \
+    PORT_GPIO_BLOCK(GPIO_PORTA_BASE_ADDRESS), \
+    PORT_GPIO_BLOCK(GPIO_PORTB_BASE_ADDRESS), \
+    PORT_GPIO_BLOCK(GPIO_PORTC_BASE_ADDRESS), \
+    PORT_GPIO_BLOCK(GPIO_PORTD_BASE_ADDRESS), \
+    PORT_GPIO_BLOCK(GPIO_PORTE_BASE_ADDRESS), \
+    PORT_GPIO_BLOCK(GPIO_PORTF_BASE_ADDRESS) \
+}
+
+
+/* System Control Registers: GPIO run mode clock gating and peripheral ready */
+#ifndef SYSCTL_RCGCGPIO_REG
+#define SYSCTL_RCGCGPIO_REG             (*((volatile uint32 *)0x400FE608))
+#define SYSCTL_PRGPIO_REG               (*((volatile uint32 *)0x400FEA08))
+#endif
+
+/* Cortex-M4 debug registers: trace enable (DEMCR.TRCENA) and DWT cycle counter */
+#define CORE_DEMCR_REG                  (*((volatile uint32 *)0xE000EDFC))
+#define CORE_DWT_CTRL_REG               (*((volatile uint32 *)0xE0001000))
+#define CORE_DWT_CYCCNT_REG             (*((volatile uint32 *)0xE0001004))
+#define CORE_DEMCR_TRCENA               0x01000000
+#define CORE_DWT_CTRL_CYCCNTENA         0x00000001
 
 
 
@@ -47,11 +47,6 @@
 #define PORT_INITIALIZED                (1U)
 #define PORT_NOT_INITIALIZED            (0U)
 
-
-/*
- * Number of modes available in Target HW
- * */
-#define NUMBER_OF_MODES                  (11U)
 /*******************************************************************************
  *                              Inclusions                                     *
  *******************************************************************************/
@@ -81,6 +76,33 @@
 /* Service ID for Port_SetPinMode */
 #define PORT_SET_PIN_MODE_SID               (uint8)0x04
 
+/* Service ID for Port_ApplyProfile */
+#define PORT_APPLY_PROFILE_SID              (uint8)0x05
+
+/* Service ID for Port_CheckIntegrity */
+#define PORT_CHECK_INTEGRITY_SID            (uint8)0x06
+
+/* Service ID for Port_EnterLowPower */
+#define PORT_ENTER_LOW_POWER_SID            (uint8)0x07
+
+/* Service ID for Port_ExitLowPower */
+#define PORT_EXIT_LOW_POWER_SID             (uint8)0x08
+
+/* Service ID for Port_InitPins */
+#define PORT_INIT_PINS_SID                  (uint8)0x09
+
+/* Service ID for Port_InitContinue */
+#define PORT_INIT_CONTINUE_SID              (uint8)0x0A
+
+/* Service ID for Port_GetInitTiming */
+#define PORT_GET_INIT_TIMING_SID            (uint8)0x0B
+
+/* Service ID for Port_GetPinState */
+#define PORT_GET_PIN_STATE_SID              (uint8)0x0C
+
+/* Service ID for Port_DumpAll */
+#define PORT_DUMP_ALL_SID                   (uint8)0x0D
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -97,6 +119,19 @@ typedef enum
     OFF, PULL_UP, PULL_DOWN
 } Port_InternalResistorType;
 
+/* Description: Enum to hold the phases of Port_Init/Port_InitPins timed by Port_GetInitTiming:
+ *  PORT_INIT_PHASE_CLOCK     --> clock enable of the ports and wait until they are ready
+ *  PORT_INIT_PHASE_UNLOCK    --> GPIOLOCK/GPIOCR of the PD7/PF0 pins
+ *  PORT_INIT_PHASE_MODE      --> GPIOAMSEL, GPIOPCTL, GPIOAFSEL and GPIODEN
+ *  PORT_INIT_PHASE_PULLS     --> GPIOPUR, GPIOPDR and the pad control (GPIODRxR, GPIOSLR, GPIOODR)
+ *  PORT_INIT_PHASE_DIRECTION --> initial GPIODATA value and GPIODIR
+ */
+typedef enum
+{
+    PORT_INIT_PHASE_CLOCK, PORT_INIT_PHASE_UNLOCK, PORT_INIT_PHASE_MODE, PORT_INIT_PHASE_PULLS,
+    PORT_INIT_PHASE_DIRECTION, PORT_INIT_NUMBER_OF_PHASES
+} Port_InitPhaseType;
+
 /* Description: Type to hold the number of a specific port
  * For the target HW there are 6 available port (A-F)
  * uint8 range (0-255)  */
@@ -115,6 +150,38 @@ typedef enum
     PORT_PIN_LEVEL_LOW, PORT_PIN_LEVEL_HIGH
 } Port_PinLevelValue;
 
+/* Description: Enum to hold the state of a PIN in low power (Port_EnterLowPower):
+ *  PORT_PIN_PARK_NONE      --> pin kept live as configured (e.g. LED, wake-up button)
+ *  PORT_PIN_PARK_ANALOG    --> analog, digital input buffer disabled (pins with an analog function)
+ *  PORT_PIN_PARK_PULL_DOWN --> digital disabled with the internal pull-down
+ *  PORT_PIN_PARK_PULL_UP   --> digital disabled with the internal pull-up
+ */
+typedef enum
+{
+    PORT_PIN_PARK_NONE, PORT_PIN_PARK_ANALOG, PORT_PIN_PARK_PULL_DOWN, PORT_PIN_PARK_PULL_UP
+} Port_PinParkType;
+
+/* Description: Enum to hold when a PIN is configured:
+ *  PORT_PIN_INIT_DEFERRED --> configured later by Port_InitContinue, one port per call
+ *  PORT_PIN_INIT_CRITICAL --> configured by Port_Init (e.g. outputs that must not float at boot)
+ */
+typedef enum
+{
+    PORT_PIN_INIT_DEFERRED, PORT_PIN_INIT_CRITICAL
+} Port_PinInitClassType;
+
+/* Description: Enum to hold the output drive strength of a PIN:
+ *  PORT_PIN_DRIVE_2MA      --> 2-mA drive (GPIODR2R), the reset state
+ *  PORT_PIN_DRIVE_4MA      --> 4-mA drive (GPIODR4R)
+ *  PORT_PIN_DRIVE_8MA      --> 8-mA drive (GPIODR8R)
+ *  PORT_PIN_DRIVE_8MA_SLEW --> 8-mA drive with slew rate control (GPIODR8R and GPIOSLR),
+ *                              the slew rate control only exists with the 8-mA drive
+ */
+typedef enum
+{
+    PORT_PIN_DRIVE_2MA, PORT_PIN_DRIVE_4MA, PORT_PIN_DRIVE_8MA, PORT_PIN_DRIVE_8MA_SLEW
+} Port_PinDriveType;
+
 /* Description: Type to hold the number an alternative operation mode
  * For the target HW there are 11 available modes
  * uint8 range (0-255)  */
@@ -135,6 +202,122 @@ typedef enum
     ANALOG
 }Port_PinModeType;
 
+/*******************************************************************************
+ *                      Target HW Allowed Modes                                *
+ *******************************************************************************/
+
+/* Bit of a mode inside an allowed-mode bitmap (ANALOG is bit 16 so the bitmap is 32-bit) */
+#define PORT_MODE_BIT(MODE)              ((uint32)1U << (uint32)(MODE))
+
+/*
+ * Allowed modes of each pin of the target HW (TM4C123GH6PM datasheet, GPIO pins and
+ * alternate functions table). PC0-PC3 are the JTAG pins and are never configured by
+ * the driver, so no mode is allowed for them.
+ */
+#define PORT_ALLOWED_MODES_PA0           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT8))
+#define PORT_ALLOWED_MODES_PA1           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT8))
+#define PORT_ALLOWED_MODES_PA2           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2))
+#define PORT_ALLOWED_MODES_PA3           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2))
+#define PORT_ALLOWED_MODES_PA4           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2))
+#define PORT_ALLOWED_MODES_PA5           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2))
+#define PORT_ALLOWED_MODES_PA6           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT3) | PORT_MODE_BIT(ALT5))
+#define PORT_ALLOWED_MODES_PA7           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT3) | PORT_MODE_BIT(ALT5))
+
+#define PORT_ALLOWED_MODES_PB0           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT7) \
+                                          | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PB1           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT7) \
+                                          | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PB2           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT3) | PORT_MODE_BIT(ALT7))
+#define PORT_ALLOWED_MODES_PB3           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT3) | PORT_MODE_BIT(ALT7))
+#define PORT_ALLOWED_MODES_PB4           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2) | PORT_MODE_BIT(ALT4) \
+                                          | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT8) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PB5           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2) | PORT_MODE_BIT(ALT4) \
+                                          | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT8) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PB6           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2) | PORT_MODE_BIT(ALT4) \
+                                          | PORT_MODE_BIT(ALT7))
+#define PORT_ALLOWED_MODES_PB7           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2) | PORT_MODE_BIT(ALT4) \
+                                          | PORT_MODE_BIT(ALT7))
+
+#define PORT_ALLOWED_MODES_PC0           (0U)
+#define PORT_ALLOWED_MODES_PC1           (0U)
+#define PORT_ALLOWED_MODES_PC2           (0U)
+#define PORT_ALLOWED_MODES_PC3           (0U)
+#define PORT_ALLOWED_MODES_PC4           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT2) \
+                                          | PORT_MODE_BIT(ALT4) | PORT_MODE_BIT(ALT6) | PORT_MODE_BIT(ALT7) \
+                                          | PORT_MODE_BIT(ALT8) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PC5           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT2) \
+                                          | PORT_MODE_BIT(ALT4) | PORT_MODE_BIT(ALT6) | PORT_MODE_BIT(ALT7) \
+                                          | PORT_MODE_BIT(ALT8) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PC6           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT6) \
+                                          | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT8) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PC7           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT7) \
+                                          | PORT_MODE_BIT(ALT8) | PORT_MODE_BIT(ANALOG))
+
+#define PORT_ALLOWED_MODES_PD0           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT2) \
+                                          | PORT_MODE_BIT(ALT3) | PORT_MODE_BIT(ALT4) | PORT_MODE_BIT(ALT5) \
+                                          | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PD1           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT2) \
+                                          | PORT_MODE_BIT(ALT3) | PORT_MODE_BIT(ALT4) | PORT_MODE_BIT(ALT5) \
+                                          | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PD2           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT2) \
+                                          | PORT_MODE_BIT(ALT4) | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT8) \
+                                          | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PD3           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT2) \
+                                          | PORT_MODE_BIT(ALT6) | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT8) \
+                                          | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PD4           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT7) \
+                                          | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PD5           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT7) \
+                                          | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PD6           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT4) \
+                                          | PORT_MODE_BIT(ALT6) | PORT_MODE_BIT(ALT7))
+#define PORT_ALLOWED_MODES_PD7           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT6) \
+                                          | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT8))
+
+#define PORT_ALLOWED_MODES_PE0           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PE1           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PE2           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PE3           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PE4           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT3) \
+                                          | PORT_MODE_BIT(ALT4) | PORT_MODE_BIT(ALT5) | PORT_MODE_BIT(ALT8) \
+                                          | PORT_MODE_BIT(ANALOG))
+#define PORT_ALLOWED_MODES_PE5           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT3) \
+                                          | PORT_MODE_BIT(ALT4) | PORT_MODE_BIT(ALT5) | PORT_MODE_BIT(ALT8) \
+                                          | PORT_MODE_BIT(ANALOG))
+
+#define PORT_ALLOWED_MODES_PF0           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT2) \
+                                          | PORT_MODE_BIT(ALT3) | PORT_MODE_BIT(ALT5) | PORT_MODE_BIT(ALT6) \
+                                          | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT8) | PORT_MODE_BIT(ALT9))
+#define PORT_ALLOWED_MODES_PF1           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT1) | PORT_MODE_BIT(ALT2) \
+                                          | PORT_MODE_BIT(ALT5) | PORT_MODE_BIT(ALT6) | PORT_MODE_BIT(ALT7) \
+                                          | PORT_MODE_BIT(ALT9) | PORT_MODE_BIT(ALT10))
+#define PORT_ALLOWED_MODES_PF2           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2) | PORT_MODE_BIT(ALT4) \
+                                          | PORT_MODE_BIT(ALT5) | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT10))
+#define PORT_ALLOWED_MODES_PF3           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT2) | PORT_MODE_BIT(ALT3) \
+                                          | PORT_MODE_BIT(ALT5) | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT10))
+#define PORT_ALLOWED_MODES_PF4           (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ALT5) | PORT_MODE_BIT(ALT6) \
+                                          | PORT_MODE_BIT(ALT7) | PORT_MODE_BIT(ALT8))
+
+/*
+ * Initializer of a [port][pin] table of the allowed modes. The pins missing in
+ * PORTE/PORTF and the JTAG pins PC0-PC3 have no allowed mode.
+ */
+#define PORT_ALLOWED_MODES_TABLE \
+{ \
+    { PORT_ALLOWED_MODES_PA0, PORT_ALLOWED_MODES_PA1, PORT_ALLOWED_MODES_PA2, PORT_ALLOWED_MODES_PA3, \
+      PORT_ALLOWED_MODES_PA4, PORT_ALLOWED_MODES_PA5, PORT_ALLOWED_MODES_PA6, PORT_ALLOWED_MODES_PA7 }, \
+    { PORT_ALLOWED_MODES_PB0, PORT_ALLOWED_MODES_PB1, PORT_ALLOWED_MODES_PB2, PORT_ALLOWED_MODES_PB3, \
+      PORT_ALLOWED_MODES_PB4, PORT_ALLOWED_MODES_PB5, PORT_ALLOWED_MODES_PB6, PORT_ALLOWED_MODES_PB7 }, \
+    { PORT_ALLOWED_MODES_PC0, PORT_ALLOWED_MODES_PC1, PORT_ALLOWED_MODES_PC2, PORT_ALLOWED_MODES_PC3, \
+      PORT_ALLOWED_MODES_PC4, PORT_ALLOWED_MODES_PC5, PORT_ALLOWED_MODES_PC6, PORT_ALLOWED_MODES_PC7 }, \
+    { PORT_ALLOWED_MODES_PD0, PORT_ALLOWED_MODES_PD1, PORT_ALLOWED_MODES_PD2, PORT_ALLOWED_MODES_PD3, \
+      PORT_ALLOWED_MODES_PD4, PORT_ALLOWED_MODES_PD5, PORT_ALLOWED_MODES_PD6, PORT_ALLOWED_MODES_PD7 }, \
+    { PORT_ALLOWED_MODES_PE0, PORT_ALLOWED_MODES_PE1, PORT_ALLOWED_MODES_PE2, PORT_ALLOWED_MODES_PE3, \
+      PORT_ALLOWED_MODES_PE4, PORT_ALLOWED_MODES_PE5, 0U, 0U }, \
+    { PORT_ALLOWED_MODES_PF0, PORT_ALLOWED_MODES_PF1, PORT_ALLOWED_MODES_PF2, PORT_ALLOWED_MODES_PF3, \
+      PORT_ALLOWED_MODES_PF4, 0U, 0U, 0U } \
+}
+
 /* Description: Structure to configure each individual PIN:
  *  1. the PORT Which the pin belongs to. 0, 1, 2, 3, 4 or 5
  *  2. the number of the pin in the PORT.
@@ -144,17 +327,190 @@ typedef enum
  *  6. initial port pin mode  (ADC, DIO, ..)
  *  7. pin direction changeable (true, false)
  *  8. pin mode changeable (true, false)
+ *  9. pin state in low power (live, analog, pull down, pull up)
+ * 10. pin configured by Port_Init or later by Port_InitContinue (critical, deferred)
+ * 11. output drive strength and slew rate control (2mA, 4mA, 8mA, 8mA with slew)
+ * 12. open drain output (true, false)
+ * The members are packed in bit-fields of one 32-bit word (23 bits used) so a pin
+ * takes 4 bytes of flash and is read with one load, each member keeps its name and
+ * is decoded by the compiler with a shift and a mask.
  */
 typedef struct
 {
-    Port_PortType port_num;
-    Port_PinType pin_num;
-    Port_PinDirectionType direction;
-    Port_InternalResistorType resistor;
-    Port_PinModeType mode;
-    Port_PinLevelValue initial_value;
-    uint8 pin_dir_changeable;
-    uint8 pin_mode_changeable;
+    uint32 port_num            : 3;    /* Port_PortType, 0..5 */
+    uint32 pin_num             : 3;    /* Port_PinType, 0..7 */
+    uint32 direction           : 1;    /* Port_PinDirectionType */
+    uint32 resistor            : 2;    /* Port_InternalResistorType */
+    uint32 mode                : 5;    /* Port_PinModeType, up to ANALOG (16) */
+    uint32 initial_value       : 1;    /* Port_PinLevelValue */
+    uint32 pin_dir_changeable  : 1;    /* STD_ON/STD_OFF */
+    uint32 pin_mode_changeable : 1;    /* STD_ON/STD_OFF */
+    uint32 park                : 2;    /* Port_PinParkType */
+    uint32 init_class          : 1;    /* Port_PinInitClassType */
+    uint32 drive               : 2;    /* Port_PinDriveType */
+    uint32 open_drain          : 1;    /* STD_ON/STD_OFF */
 } Port_ConfigPin;
 
+/*******************************************************************************
+ *                  Compile-time checks of the configured pins                 *
+ *******************************************************************************/
+
+/* PC0-PC3 are the JTAG pins */
+#define PORT_PIN_IS_JTAG(PORT, PIN) \
+    (((PORT) == PORT_PortC) && ((PIN) <= PORT_Pin3))
+
+/* PD7 and PF0 are protected by the GPIOLOCK/GPIOCR registers */
+#define PORT_PIN_IS_LOCKED(PORT, PIN) \
+    ((((PORT) == PORT_PortD) && ((PIN) == PORT_Pin7)) || (((PORT) == PORT_PortF) && ((PIN) == PORT_Pin0)))
+
+/* Pins never configured by the driver: the JTAG pins, and PD7/PF0 when PORT_UNLOCK_LOCKED_PINS is STD_OFF */
+#define PORT_PIN_IS_RESERVED(PORT, PIN) \
+    (PORT_PIN_IS_JTAG(PORT, PIN) \
+            || ((PORT_UNLOCK_LOCKED_PINS == STD_OFF) && PORT_PIN_IS_LOCKED(PORT, PIN)))
+
+/*
+ * Constant expression equal to 0 when COND is true, otherwise a compilation error
+ * (negative array size). Usable inside the initializers of the configuration.
+ */
+#define PORT_STATIC_CHECK(COND)          (0U * (uint32)sizeof(char[(COND) ? 1 : -1]))
+
+/*
+ * A reserved pin may only be listed with its direction and mode unchangeable, kept
+ * live in low power and with the reset pad control (2-mA drive, no open drain). Any
+ * other pin needs a mode allowed on it (PORT_ALLOWED_MODES_Pxn) and an analog
+ * function to be parked as analog.
+ */
+#define PORT_PIN_CONFIG_IS_VALID(PORT, PIN, MODE, DIRCH, MODECH, PARK, DRIVE, ODR) \
+    (PORT_PIN_IS_RESERVED(PORT_Port##PORT, PORT_Pin##PIN) \
+            ? (((DIRCH) == STD_OFF) && ((MODECH) == STD_OFF) && ((PARK) == PORT_PIN_PARK_NONE) \
+                    && ((DRIVE) == PORT_PIN_DRIVE_2MA) && ((ODR) == STD_OFF)) \
+            : (((PORT_ALLOWED_MODES_P##PORT##PIN & PORT_MODE_BIT(MODE)) != 0U) \
+                    && (((PARK) != PORT_PIN_PARK_ANALOG) \
+                            || ((PORT_ALLOWED_MODES_P##PORT##PIN & PORT_MODE_BIT(ANALOG)) != 0U))))
+
+/*
+ * Initializer of a Port_ConfigPin checked at compile time, the port is given by its
+ * letter and the pin by its number: PORT_PIN_CONFIG(F, 1, PORT_PIN_OUT, ...) is PF1.
+ */
+#define PORT_PIN_CONFIG(PORT, PIN, DIR, RES, MODE, INIT, DIRCH, MODECH, PARK, CLASS, DRIVE, ODR) \
+    { PORT_Port##PORT + PORT_STATIC_CHECK(PORT_PIN_CONFIG_IS_VALID(PORT, PIN, MODE, DIRCH, MODECH, PARK, DRIVE, ODR)), \
+      PORT_Pin##PIN, DIR, RES, MODE, INIT, DIRCH, MODECH, PARK, CLASS, DRIVE, ODR }
+
+/*
+ * Initializer of a Port_ConfigPin naming a signal of the pin-mux database (Port_PinMux.h)
+ * instead of the port, pin and mode: PORT_PIN_CONFIG_MUX(PA0_U0RX, PORT_PIN_IN, ...) or
+ * PORT_PIN_CONFIG_MUX(U0RX, PORT_PIN_IN, ...). PORT_MUX_x expands to "PORT, PIN, MODE"
+ * when it is an argument of PORT_PIN_CONFIG_MUX_ARGS, so the checks of PORT_PIN_CONFIG apply.
+ */
+#define PORT_PIN_CONFIG_MUX(MUX, DIR, RES, INIT, DIRCH, MODECH, PARK, CLASS, DRIVE, ODR) \
+    PORT_PIN_CONFIG_MUX_ARGS(PORT_MUX_##MUX, DIR, RES, INIT, DIRCH, MODECH, PARK, CLASS, DRIVE, ODR)
+#define PORT_PIN_CONFIG_MUX_ARGS(MUX, DIR, RES, INIT, DIRCH, MODECH, PARK, CLASS, DRIVE, ODR) \
+    PORT_PIN_CONFIG_MUX_PIN(MUX, DIR, RES, INIT, DIRCH, MODECH, PARK, CLASS, DRIVE, ODR)
+#define PORT_PIN_CONFIG_MUX_PIN(PORT, PIN, MODE, DIR, RES, INIT, DIRCH, MODECH, PARK, CLASS, DRIVE, ODR) \
+    PORT_PIN_CONFIG(PORT, PIN, DIR, RES, MODE, INIT, DIRCH, MODECH, PARK, CLASS, DRIVE, ODR)
+
+/* Mode (Port_PinModeType constant) of a signal of the pin-mux database, e.g. for Port_SetPinMode */
+#define PORT_MUX_MODE(MUX)               PORT_MUX_MODE_ARGS(PORT_MUX_##MUX)
+#define PORT_MUX_MODE_ARGS(MUX)          PORT_MUX_MODE_OF(MUX)
+#define PORT_MUX_MODE_OF(PORT, PIN, MODE) (MODE)
+
+/* Description: Type to hold the ID of a pin-configuration profile
+ * uint8 range (0-255)  */
+typedef uint8 Port_ProfileIdType;
+
+/* Description: Type to hold the ID of a post-build configuration set
+ * uint8 range (0-255)  */
+typedef uint8 Port_ConfigSetIdType;
+
+/* Description: Type to hold the state of a pin read back from the GPIO registers
+ * (Port_GetPinState, Port_DumpAll), packed in 16 bits with the PORT_PIN_STATE_ masks:
+ *  bit  0    --> level (GPIODATA)
+ *  bit  1    --> output (GPIODIR)
+ *  bit  2    --> digital enabled (GPIODEN)
+ *  bit  3    --> alternative function (GPIOAFSEL)
+ *  bit  4    --> analog (GPIOAMSEL)
+ *  bit  5    --> pull up (GPIOPUR)
+ *  bit  6    --> pull down (GPIOPDR)
+ *  bits 8-11 --> PMCx value (GPIOPCTL)
+ *  bit 15    --> port clock gated, the other bits are 0
+ * uint16 range (0-65535)  */
+typedef uint16 Port_PinStateType;
+
+#define PORT_PIN_STATE_LEVEL             ((Port_PinStateType)0x0001U)
+#define PORT_PIN_STATE_OUTPUT            ((Port_PinStateType)0x0002U)
+#define PORT_PIN_STATE_DIGITAL           ((Port_PinStateType)0x0004U)
+#define PORT_PIN_STATE_ALT_FUNC          ((Port_PinStateType)0x0008U)
+#define PORT_PIN_STATE_ANALOG            ((Port_PinStateType)0x0010U)
+#define PORT_PIN_STATE_PULL_UP           ((Port_PinStateType)0x0020U)
+#define PORT_PIN_STATE_PULL_DOWN         ((Port_PinStateType)0x0040U)
+#define PORT_PIN_STATE_PCTL_MASK         ((Port_PinStateType)0x0F00U)
+#define PORT_PIN_STATE_PCTL_SHIFT        (8U)
+#define PORT_PIN_STATE_GATED             ((Port_PinStateType)0x8000U)
+
+/* Description: Pins reconfigured together by Port_ApplyProfile,
+ * the other pins of the ports keep their current configuration */
+typedef struct
+{
+    const Port_ConfigPin *Pins;
+    uint8 NumberOfPins;
+} Port_ProfileConfigType;
+
+/* Description: Final values of the GPIO registers of one port computed from its configured pins:
+ *  1. mask   --> pins of the port owned by the configuration
+ *  2. dir, data, den, afsel, amsel, pur, pdr --> one bit per pin of the register
+ *  3. pctl   --> PMCx nibbles of the alternative functions
+ *  4. commit --> protected pins (PD7, PF0) to unlock in GPIOCR
+ *  5. dir_refresh --> pins with a direction not changeable during runtime, restored
+ *                     from dir by Port_RefreshPortDirection
+ *  6. dr2r, dr4r, dr8r, slr, odr --> pad control, one bit per pin of the register, each
+ *                     owned pin is set in exactly one of dr2r/dr4r/dr8r
+ */
+typedef struct
+{
+    uint8 mask;
+    uint8 dir;
+    uint8 data;
+    uint8 den;
+    uint8 afsel;
+    uint8 amsel;
+    uint8 pur;
+    uint8 pdr;
+    uint8 commit;
+    uint8 dir_refresh;
+    uint8 dr2r;
+    uint8 dr4r;
+    uint8 dr8r;
+    uint8 slr;
+    uint8 odr;
+    uint32 pctl;
+} Port_RegImageType;
+
+/* Description: Pin resolved at generation time (Tools/PortCfgGen) for the runtime services,
+ * one per Port_PinType so Port_SetPinDirection/Port_SetPinMode need no lookup:
+ *  1. base          --> GPIO base address of the port of the pin
+ *  2. allowed_modes --> PORT_MODE_BIT bitmap of the modes of the pin, 0 for a reserved pin
+ *  3. port_num      --> port of the pin, index of its shadow
+ *  4. bit           --> bit of the pin in the 8-bit GPIO registers
+ *  5. pctl_shift    --> position of the PMCx nibble of the pin in GPIOPCTL
+ *  6. commit        --> bit of the pin when it is protected by GPIOCR (PD7, PF0), else 0
+ */
+typedef struct
+{
+    uint32 base;
+    uint32 allowed_modes;
+    uint8 port_num;
+    uint8 bit;
+    uint8 pctl_shift;
+    uint8 commit;
+} Port_PinDescType;
+
+/* Description: Pins of one port parked by Port_EnterLowPower, one bit per pin for each
+ * low power state, the pins of the port not set in any of them stay live */
+typedef struct
+{
+    uint8 analog;
+    uint8 pull_down;
+    uint8 pull_up;
+} Port_ParkImageType;
+
 #endif /* PORT_TYPES_H_ */
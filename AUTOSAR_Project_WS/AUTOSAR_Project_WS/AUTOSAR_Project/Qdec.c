@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ * Module: Qdec
+ *
+ * File Name: Qdec.c
+ *
+ * Description: Source file for Software Quadrature Decoder Module.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include "Qdec.h"
+#include "Dio_Regs.h"
+
+#if (QDEC_EDGE_INTERRUPT == STD_ON)
+#include "tm4c123gh6pm_registers.h"
+#endif
+
+/* Encoder state is (B << 1) | A, the transition index is (previous state << 2) | current state */
+#define QDEC_STATE_BITS             (2U)
+
+/* Transitions where both phases changed: 0<->3 and 1<->2 */
+#define QDEC_ILLEGAL_TRANSITIONS    (0x1248U)
+
+/* Both phases are sampled by one GPIODATA read, phases configured on two ports do not compile */
+typedef char Qdec_PhasesOnOnePortCheck[(QDEC_PHASE_A_PORT_NUM == QDEC_PHASE_B_PORT_NUM) ? 1 : -1];
+
+/* NVIC interrupt number of GPIO Port F (Ports A-E are 0-4) */
+#define QDEC_GPIO_PORTF_IRQ_NUM     (30U)
+
+/*
+ * Position step for each transition, forward sequence is 0 -> 1 -> 3 -> 2 -> 0.
+ * No change and illegal transitions give 0.
+ */
+STATIC const sint8 Qdec_TransitionTable[16] =
+{
+    /* prev 0 */  0, +1, -1,  0,
+    /* prev 1 */ -1,  0,  0, +1,
+    /* prev 2 */ +1,  0,  0, -1,
+    /* prev 3 */  0, -1, +1,  0
+};
+
+/* GPIO register blocks of the ports indexed by the Port_Num member of the channels */
+STATIC Port_GpioRegsType * const Qdec_GpioBlock[DIO_NUMBER_OF_PORTS] =
+        PORT_GPIO_BLOCK_TABLE;
+
+/* GPIO register block of the port of the phase pins */
+STATIC Port_GpioRegsType * Qdec_Gpio = NULL_PTR;
+
+/* Both phase pins, masks the GPIODATA read and the interrupt registers */
+STATIC uint32 Qdec_Mask = 0;
+
+/* Pin numbers of the phases inside the port */
+STATIC uint8 Qdec_PhaseA_Pin = 0;
+STATIC uint8 Qdec_PhaseB_Pin = 0;
+
+/* Last sampled encoder state */
+STATIC uint8 Qdec_State = 0;
+
+/* Encoder position in quadrature counts */
+STATIC volatile sint32 Qdec_Position = 0;
+
+/* Number of illegal transitions (missed edges) */
+STATIC volatile uint32 Qdec_ErrorCount = 0;
+
+/************************************************************************************/
+/* Description: Sample both phases with one masked read and return (B << 1) | A */
+STATIC uint8 Qdec_ReadState(void)
+{
+    uint32 sample = PORT_GPIO(Qdec_Gpio, DATA[Qdec_Mask]);
+
+    return (uint8)(((sample >> Qdec_PhaseA_Pin) & 0x01U)
+            | (((sample >> Qdec_PhaseB_Pin) & 0x01U) << 1));
+}
+
+/************************************************************************************/
+void Qdec_Init(void)
+{
+    const Dio_ConfigChannel * PhaseA = &Dio_Configuration.Channels[QDEC_PHASE_A_CHANNEL_ID_INDEX];
+    const Dio_ConfigChannel * PhaseB = &Dio_Configuration.Channels[QDEC_PHASE_B_CHANNEL_ID_INDEX];
+#if (QDEC_EDGE_INTERRUPT == STD_ON)
+    uint32 value = 0;
+#endif
+
+    Qdec_PhaseA_Pin = PhaseA->Ch_Num;
+    Qdec_PhaseB_Pin = PhaseB->Ch_Num;
+    Qdec_Mask = ((uint32)1U << Qdec_PhaseA_Pin) | ((uint32)1U << Qdec_PhaseB_Pin);
+    Qdec_Gpio = Qdec_GpioBlock[PhaseA->Port_Num];
+
+    Qdec_State      = Qdec_ReadState();
+    Qdec_Position   = 0;
+    Qdec_ErrorCount = 0;
+
+#if (QDEC_EDGE_INTERRUPT == STD_ON)
+    /* Edge sensitive (GPIOIS = 0) on both edges (GPIOIBE = 1) */
+    value = PORT_GPIO(Qdec_Gpio, IS);
+    PORT_GPIO(Qdec_Gpio, IS) = value & ~Qdec_Mask;
+    value = PORT_GPIO(Qdec_Gpio, IBE);
+    PORT_GPIO(Qdec_Gpio, IBE) = value | Qdec_Mask;
+
+    /* Clear any pending flag then unmask the phase pins interrupts */
+    PORT_GPIO(Qdec_Gpio, ICR) = Qdec_Mask;
+    value = PORT_GPIO(Qdec_Gpio, IM);
+    PORT_GPIO(Qdec_Gpio, IM) = value | Qdec_Mask;
+
+    /* Enable the port interrupt in the NVIC */
+    if(PhaseA->Port_Num == 5)
+    {
+        NVIC_EN0_REG = (1UL << QDEC_GPIO_PORTF_IRQ_NUM);
+    }
+    else
+    {
+        NVIC_EN0_REG = (1UL << PhaseA->Port_Num);
+    }
+#endif
+}
+
+/************************************************************************************/
+void Qdec_Update(void)
+{
+    uint8 state = Qdec_ReadState();
+    uint8 transition = (uint8)((Qdec_State << QDEC_STATE_BITS) | state);
+
+    /* Branch-less decode: the table gives the step and the mask flags the missed edges */
+    Qdec_Position   += Qdec_TransitionTable[transition];
+    Qdec_ErrorCount += (QDEC_ILLEGAL_TRANSITIONS >> transition) & 0x01U;
+    Qdec_State       = state;
+}
+
+/************************************************************************************/
+void Qdec_EdgeHandler(void)
+{
+    /* Clear the flags before sampling so that an edge arriving after the read raises a new interrupt */
+    PORT_GPIO(Qdec_Gpio, ICR) = Qdec_Mask;
+
+    Qdec_Update();
+}
+
+/************************************************************************************/
+sint32 Qdec_GetPosition(void)
+{
+    return Qdec_Position;
+}
+
+/************************************************************************************/
+uint32 Qdec_GetErrorCount(void)
+{
+    return Qdec_ErrorCount;
+}
@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Module: Qdec
+ *
+ * File Name: Qdec.h
+ *
+ * Description: Header file for Software Quadrature Decoder Module.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef QDEC_H
+#define QDEC_H
+
+/* Qdec Module Id (vendor specific complex driver) */
+#define QDEC_MODULE_ID    (255U)
+
+/* Qdec Instance Id */
+#define QDEC_INSTANCE_ID  (0U)
+
+#include "Std_Types.h"
+#include "Dio.h"
+#include "Qdec_Cfg.h"
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Qdec_Init
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to resolve the register block of the phase channels,
+*              sample the initial encoder state, clear the position and arm the
+*              both-edges interrupt when QDEC_EDGE_INTERRUPT is enabled.
+************************************************************************************/
+void Qdec_Init(void);
+
+/************************************************************************************
+* Service Name: Qdec_Update
+* Sync/Async: Synchronous
+* Reentrancy: non-reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to sample both phases with one masked port read and
+*              advance the position through the state-transition table.
+*              Called from the edge interrupt or from a high-rate timer poll,
+*              after Qdec_Init.
+************************************************************************************/
+void Qdec_Update(void);
+
+/************************************************************************************
+* Service Name: Qdec_EdgeHandler
+* Description: GPIO edge ISR of the encoder port, clears the phase pins
+*              interrupt flags and calls Qdec_Update.
+************************************************************************************/
+void Qdec_EdgeHandler(void);
+
+/************************************************************************************
+* Service Name: Qdec_GetPosition
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: sint32 - Encoder position in quadrature counts (4 per cycle)
+* Description: Function to get the current encoder position.
+************************************************************************************/
+sint32 Qdec_GetPosition(void);
+
+/************************************************************************************
+* Service Name: Qdec_GetErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of illegal transitions (both phases changed)
+* Description: Function to get the number of illegal transitions, each one means
+*              an edge was missed because the edge rate exceeded the sampling rate.
+************************************************************************************/
+uint32 Qdec_GetErrorCount(void);
+
+#endif /* QDEC_H */
@@ -0,0 +1,37 @@
+/******************************************************************************
+ *
+ * Module: Qdec
+ *
+ * File Name: Qdec_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Qdec Module
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef QDEC_CFG_H_
+#define QDEC_CFG_H_
+
+/*
+ * Dio channels connected to the encoder phases.
+ * Both channels must belong to the same port so that they are sampled
+ * together by a single masked GPIODATA read, checked when Qdec.c is compiled.
+ */
+#define QDEC_PHASE_A_CHANNEL_ID_INDEX   DioConf_ENCA_CHANNEL_ID_INDEX
+#define QDEC_PHASE_B_CHANNEL_ID_INDEX   DioConf_ENCB_CHANNEL_ID_INDEX
+#define QDEC_PHASE_A_PORT_NUM           DioConf_ENCA_PORT_NUM
+#define QDEC_PHASE_B_PORT_NUM           DioConf_ENCB_PORT_NUM
+
+/*
+ * Enable/Disable the GPIO both-edges interrupt on the phase pins.
+ * STD_ON : Qdec_EdgeHandler must be placed in the vector table entry of the
+ *          encoder port (GPIO Port D for the current channels).
+ * STD_OFF: Qdec_Update must be called periodically (e.g. from a timer ISR)
+ *          at a rate higher than the maximum encoder edge rate.
+ * Can also be set from the build command line as done by Tools/QdecBench.
+ */
+#ifndef QDEC_EDGE_INTERRUPT
+#define QDEC_EDGE_INTERRUPT             (STD_ON)
+#endif
+
+#endif /* QDEC_CFG_H_ */
@@ -0,0 +1,280 @@
+/******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio_Bench.c
+ *
+ * Description: Host benchmark of the Dio channel APIs. Dio.c runs against
+ *              simulated GPIO register blocks (Dio_BenchRegs.h) that count the
+ *              register accesses. For each API the benchmark gives the calls
+ *              per second, the instructions per call (Linux perf hardware
+ *              counter) and the register (MMIO) accesses per call, written as
+ *              JSON so that the results can be compared between revisions.
+ *
+ *              DIO_DEV_ERROR_DETECT is a pre-compile option, build and run one
+ *              binary per configuration on Linux from this directory:
+ *                gcc -O2 -o Dio_Bench_DetOn -include Dio_BenchRegs.h -DDIO_DEV_ERROR_DETECT=STD_ON
+ *                    -I. -I../../AUTOSAR_Project Dio_Bench.c ../../AUTOSAR_Project/Dio.c
+ *                    ../../AUTOSAR_Project/Dio_PBcfg.c
+ *                gcc -O2 -o Dio_Bench_DetOff -include Dio_BenchRegs.h -DDIO_DEV_ERROR_DETECT=STD_OFF
+ *                    -I. -I../../AUTOSAR_Project Dio_Bench.c ../../AUTOSAR_Project/Dio.c
+ *                    ../../AUTOSAR_Project/Dio_PBcfg.c
+ *                ./Dio_Bench_DetOn Dio_Bench_DetOn.json
+ *                ./Dio_Bench_DetOff Dio_Bench_DetOff.json
+ *
+ *              A register access is one expansion of PORT_GPIO. The instructions
+ *              per call exclude the benchmark loop and the access counter, both
+ *              measured separately and subtracted. They are null when the perf
+ *              counters are not available (e.g. perf_event_paranoid, containers).
+ *              The host figures compare configurations and revisions, they are
+ *              not the cycles of the target.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "Dio.h"
+#include "Dio_Regs.h"
+#include "Det.h"
+
+/* Number of calls of each measure */
+#define BENCH_CALLS                     (5000000UL)
+
+/* Measured APIs, Dio_FlipChannel only when DIO_FLIP_CHANNEL_API is enabled */
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+#define BENCH_NUMBER_OF_APIS            (3U)
+#else
+#define BENCH_NUMBER_OF_APIS            (2U)
+#endif
+
+typedef void (*Bench_CallType)(uint32 Index);
+
+typedef struct
+{
+    double calls_per_s;
+    double instructions;            /* Instructions of the measure, negative when not counted */
+    unsigned long accesses;
+} Bench_ResultType;
+
+Port_GpioRegsType Bench_GpioBlocks[DIO_NUMBER_OF_PORTS];
+
+static unsigned long Bench_RegAccesses;
+static unsigned long Bench_DetErrors;
+
+/* Sink of the read levels, keeps the calls from being optimized out */
+static volatile Dio_LevelType Bench_Level;
+
+/* Register used to measure the cost of the access counter */
+static volatile uint32 Bench_CounterReg;
+
+/* File descriptor of the instructions counter, -1 when not available */
+static int Bench_PerfFd = -1;
+
+/************************************************************************************/
+/* Description: Simulated GPIO register of a port, in Bench_GpioBlocks */
+volatile uint32 * Bench_GpioReg(volatile uint32 *Reg)
+{
+    Bench_RegAccesses++;
+    return Reg;
+}
+
+/************************************************************************************/
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    (void)ApiId;
+    (void)ErrorId;
+    Bench_DetErrors++;
+    return E_OK;
+}
+
+/************************************************************************************/
+/* Description: Calls of the measured APIs, the configured channels are used in turn */
+static __attribute__((noinline)) void Bench_Write(uint32 Index)
+{
+    Dio_WriteChannel((Dio_ChannelType)(Index % DIO_CONFIGURED_CHANNLES), (Dio_LevelType)(Index & 1U));
+}
+
+static __attribute__((noinline)) void Bench_Read(uint32 Index)
+{
+    Bench_Level = Dio_ReadChannel((Dio_ChannelType)(Index % DIO_CONFIGURED_CHANNLES));
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+static __attribute__((noinline)) void Bench_Flip(uint32 Index)
+{
+    Bench_Level = Dio_FlipChannel((Dio_ChannelType)(Index % DIO_CONFIGURED_CHANNLES));
+}
+#endif
+
+/* Description: Same argument and sink as the APIs calls, without the call (loop cost) */
+static __attribute__((noinline)) void Bench_Nothing(uint32 Index)
+{
+    Bench_Level = (Dio_LevelType)(Index % DIO_CONFIGURED_CHANNLES);
+}
+
+/* Description: One access through the counter (cost of the counter, subtracted per access) */
+static __attribute__((noinline)) void Bench_Counter(uint32 Index)
+{
+    *Bench_GpioReg(&Bench_CounterReg) = Index % DIO_CONFIGURED_CHANNLES;
+}
+
+static const Bench_CallType Bench_Api[BENCH_NUMBER_OF_APIS] =
+{
+    Bench_Write,
+    Bench_Read,
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+    Bench_Flip
+#endif
+};
+
+static const char * const Bench_ApiName[BENCH_NUMBER_OF_APIS] =
+{
+    "Dio_WriteChannel",
+    "Dio_ReadChannel",
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+    "Dio_FlipChannel"
+#endif
+};
+
+/************************************************************************************/
+/* Description: Open the user space instructions counter of this thread */
+static int Bench_PerfOpen(void)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/************************************************************************************/
+/* Description: Host time in ns */
+static unsigned long long Bench_Now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+/************************************************************************************/
+/* Description: Call a function BENCH_CALLS times, counting time, instructions and accesses */
+static void Bench_Measure(Bench_CallType Call, Bench_ResultType * Result)
+{
+    unsigned long long start;
+    unsigned long long elapsed;
+    long long instructions = 0;
+    uint32 index;
+
+    memset((void *)Bench_GpioBlocks, 0, sizeof(Bench_GpioBlocks));
+    Bench_RegAccesses = 0;
+
+    if (Bench_PerfFd >= 0)
+    {
+        ioctl(Bench_PerfFd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(Bench_PerfFd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    start = Bench_Now();
+    for (index = 0; index < BENCH_CALLS; index++)
+    {
+        Call(index);
+    }
+    elapsed = Bench_Now() - start;
+
+    if (Bench_PerfFd >= 0)
+    {
+        ioctl(Bench_PerfFd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(Bench_PerfFd, &instructions, sizeof(instructions)) != (ssize_t)sizeof(instructions))
+        {
+            instructions = -1;
+        }
+    }
+    else
+    {
+        instructions = -1;
+    }
+
+    Result->calls_per_s = (elapsed != 0U) ? (double)BENCH_CALLS * 1e9 / (double)elapsed : 0.0;
+    Result->instructions = (instructions >= 0) ? (double)instructions / BENCH_CALLS : -1.0;
+    Result->accesses = Bench_RegAccesses;
+}
+
+/************************************************************************************/
+int main(int argc, char * argv[])
+{
+    Bench_ResultType loop;
+    Bench_ResultType counter;
+    Bench_ResultType result;
+    FILE * out = stdout;
+    double mmio_per_call;
+    uint8 api;
+
+    if (argc > 1)
+    {
+        out = fopen(argv[1], "w");
+        if (out == NULL)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    Bench_PerfFd = Bench_PerfOpen();
+    Dio_Init(&Dio_Configuration);
+
+    Bench_Measure(Bench_Nothing, &loop);
+    Bench_Measure(Bench_Counter, &counter);
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"module\": \"Dio\",\n");
+    fprintf(out, "  \"dev_error_detect\": %s,\n", (DIO_DEV_ERROR_DETECT == STD_ON) ? "true" : "false");
+    fprintf(out, "  \"calls\": %lu,\n", BENCH_CALLS);
+    fprintf(out, "  \"perf_counters\": %s,\n", (loop.instructions >= 0.0) ? "true" : "false");
+    fprintf(out, "  \"results\": [\n");
+
+    for (api = 0; api < BENCH_NUMBER_OF_APIS; api++)
+    {
+        Bench_Measure(Bench_Api[api], &result);
+        mmio_per_call = (double)result.accesses / BENCH_CALLS;
+
+        fprintf(out, "    {\"api\": \"%s\", \"calls_per_s\": %.0f, \"instructions_per_call\": ",
+                Bench_ApiName[api], result.calls_per_s);
+        if ((result.instructions >= 0.0) && (loop.instructions >= 0.0))
+        {
+            fprintf(out, "%.1f", result.instructions - loop.instructions
+                    - mmio_per_call * (counter.instructions - loop.instructions));
+        }
+        else
+        {
+            fprintf(out, "null");
+        }
+        fprintf(out, ", \"mmio_per_call\": %.2f}%s\n", mmio_per_call,
+                (api + 1U < BENCH_NUMBER_OF_APIS) ? "," : "");
+    }
+
+    fprintf(out, "  ],\n");
+    fprintf(out, "  \"det_errors\": %lu\n", Bench_DetErrors);
+    fprintf(out, "}\n");
+
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    return 0;
+}
@@ -0,0 +1,294 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PinMuxGen.c
+ *
+ * Description: Host tool generating the pin-mux database of the Port Driver.
+ *              The signals of the TM4C123GH6PM (datasheet, GPIO pins and alternate
+ *              functions table) are listed once below with their pin and mode, the
+ *              mode of each signal is checked against PORT_ALLOWED_MODES_TABLE and
+ *              Port_PinMux.h is written with one PORT_MUX_Pxn_SIGNAL entry per signal
+ *              and pin, plus a PORT_MUX_SIGNAL alias for the signals found on one pin
+ *              only. Port_PBcfg.c then names the signals with PORT_PIN_CONFIG_MUX.
+ *
+ *              Build and run on Linux from this directory after changing Gen_Signals:
+ *                gcc -o Port_PinMuxGen -I../../AUTOSAR_Project Port_PinMuxGen.c
+ *                ./Port_PinMuxGen ../../AUTOSAR_Project/Port_PinMux.h
+ *
+ *              Exits with 1 and writes nothing when an entry is invalid.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "Port_Cfg.h"
+#include "Port_Types.h"
+
+/* The generated files use the line endings of the project */
+#define NL "\r\n"
+
+/* Signal of the pin-mux table: port letter, pin number, signal name and mode */
+typedef struct
+{
+    char port;
+    uint8 pin;
+    const char * signal;
+    Port_PinModeType mode;
+} Gen_SignalType;
+
+/*
+ * Signals of each pin in the order of the datasheet table. The JTAG pins PC0-PC3 are
+ * left out, they are never configured by the driver. The analog functions (ADC inputs,
+ * analog comparators, USB analog pins) use the ANALOG mode.
+ */
+static const Gen_SignalType Gen_Signals[] =
+{
+    { 'A', 0, "U0RX", ALT1 },      { 'A', 0, "CAN1RX", ALT8 },
+    { 'A', 1, "U0TX", ALT1 },      { 'A', 1, "CAN1TX", ALT8 },
+    { 'A', 2, "SSI0CLK", ALT2 },
+    { 'A', 3, "SSI0FSS", ALT2 },
+    { 'A', 4, "SSI0RX", ALT2 },
+    { 'A', 5, "SSI0TX", ALT2 },
+    { 'A', 6, "I2C1SCL", ALT3 },   { 'A', 6, "M1PWM2", ALT5 },
+    { 'A', 7, "I2C1SDA", ALT3 },   { 'A', 7, "M1PWM3", ALT5 },
+
+    { 'B', 0, "USB0ID", ANALOG },  { 'B', 0, "U1RX", ALT1 },      { 'B', 0, "T2CCP0", ALT7 },
+    { 'B', 1, "USB0VBUS", ANALOG },{ 'B', 1, "U1TX", ALT1 },      { 'B', 1, "T2CCP1", ALT7 },
+    { 'B', 2, "I2C0SCL", ALT3 },   { 'B', 2, "T3CCP0", ALT7 },
+    { 'B', 3, "I2C0SDA", ALT3 },   { 'B', 3, "T3CCP1", ALT7 },
+    { 'B', 4, "AIN10", ANALOG },   { 'B', 4, "SSI2CLK", ALT2 },   { 'B', 4, "M0PWM2", ALT4 },
+    { 'B', 4, "T1CCP0", ALT7 },    { 'B', 4, "CAN0RX", ALT8 },
+    { 'B', 5, "AIN11", ANALOG },   { 'B', 5, "SSI2FSS", ALT2 },   { 'B', 5, "M0PWM3", ALT4 },
+    { 'B', 5, "T1CCP1", ALT7 },    { 'B', 5, "CAN0TX", ALT8 },
+    { 'B', 6, "SSI2RX", ALT2 },    { 'B', 6, "M0PWM0", ALT4 },    { 'B', 6, "T0CCP0", ALT7 },
+    { 'B', 7, "SSI2TX", ALT2 },    { 'B', 7, "M0PWM1", ALT4 },    { 'B', 7, "T0CCP1", ALT7 },
+
+    { 'C', 4, "C1M", ANALOG },     { 'C', 4, "U4RX", ALT1 },      { 'C', 4, "U1RX", ALT2 },
+    { 'C', 4, "M0PWM6", ALT4 },    { 'C', 4, "IDX1", ALT6 },      { 'C', 4, "WT0CCP0", ALT7 },
+    { 'C', 4, "U1RTS", ALT8 },
+    { 'C', 5, "C1P", ANALOG },     { 'C', 5, "U4TX", ALT1 },      { 'C', 5, "U1TX", ALT2 },
+    { 'C', 5, "M0PWM7", ALT4 },    { 'C', 5, "PHA1", ALT6 },      { 'C', 5, "WT0CCP1", ALT7 },
+    { 'C', 5, "U1CTS", ALT8 },
+    { 'C', 6, "C0P", ANALOG },     { 'C', 6, "U3RX", ALT1 },      { 'C', 6, "PHB1", ALT6 },
+    { 'C', 6, "WT1CCP0", ALT7 },   { 'C', 6, "USB0EPEN", ALT8 },
+    { 'C', 7, "C0M", ANALOG },     { 'C', 7, "U3TX", ALT1 },      { 'C', 7, "WT1CCP1", ALT7 },
+    { 'C', 7, "USB0PFLT", ALT8 },
+
+    { 'D', 0, "AIN7", ANALOG },    { 'D', 0, "SSI3CLK", ALT1 },   { 'D', 0, "SSI1CLK", ALT2 },
+    { 'D', 0, "I2C3SCL", ALT3 },   { 'D', 0, "M0PWM6", ALT4 },    { 'D', 0, "M1PWM0", ALT5 },
+    { 'D', 0, "WT2CCP0", ALT7 },
+    { 'D', 1, "AIN6", ANALOG },    { 'D', 1, "SSI3FSS", ALT1 },   { 'D', 1, "SSI1FSS", ALT2 },
+    { 'D', 1, "I2C3SDA", ALT3 },   { 'D', 1, "M0PWM7", ALT4 },    { 'D', 1, "M1PWM1", ALT5 },
+    { 'D', 1, "WT2CCP1", ALT7 },
+    { 'D', 2, "AIN5", ANALOG },    { 'D', 2, "SSI3RX", ALT1 },    { 'D', 2, "SSI1RX", ALT2 },
+    { 'D', 2, "M0FAULT0", ALT4 },  { 'D', 2, "WT3CCP0", ALT7 },   { 'D', 2, "USB0EPEN", ALT8 },
+    { 'D', 3, "AIN4", ANALOG },    { 'D', 3, "SSI3TX", ALT1 },    { 'D', 3, "SSI1TX", ALT2 },
+    { 'D', 3, "IDX0", ALT6 },      { 'D', 3, "WT3CCP1", ALT7 },   { 'D', 3, "USB0PFLT", ALT8 },
+    { 'D', 4, "USB0DM", ANALOG },  { 'D', 4, "U6RX", ALT1 },      { 'D', 4, "WT4CCP0", ALT7 },
+    { 'D', 5, "USB0DP", ANALOG },  { 'D', 5, "U6TX", ALT1 },      { 'D', 5, "WT4CCP1", ALT7 },
+    { 'D', 6, "U2RX", ALT1 },      { 'D', 6, "M0FAULT0", ALT4 },  { 'D', 6, "PHA0", ALT6 },
+    { 'D', 6, "WT5CCP0", ALT7 },
+    { 'D', 7, "U2TX", ALT1 },      { 'D', 7, "PHB0", ALT6 },      { 'D', 7, "WT5CCP1", ALT7 },
+    { 'D', 7, "NMI", ALT8 },
+
+    { 'E', 0, "AIN3", ANALOG },    { 'E', 0, "U7RX", ALT1 },
+    { 'E', 1, "AIN2", ANALOG },    { 'E', 1, "U7TX", ALT1 },
+    { 'E', 2, "AIN1", ANALOG },
+    { 'E', 3, "AIN0", ANALOG },
+    { 'E', 4, "AIN9", ANALOG },    { 'E', 4, "U5RX", ALT1 },      { 'E', 4, "I2C2SCL", ALT3 },
+    { 'E', 4, "M0PWM4", ALT4 },    { 'E', 4, "M1PWM2", ALT5 },    { 'E', 4, "CAN0RX", ALT8 },
+    { 'E', 5, "AIN8", ANALOG },    { 'E', 5, "U5TX", ALT1 },      { 'E', 5, "I2C2SDA", ALT3 },
+    { 'E', 5, "M0PWM5", ALT4 },    { 'E', 5, "M1PWM3", ALT5 },    { 'E', 5, "CAN0TX", ALT8 },
+
+    { 'F', 0, "U1RTS", ALT1 },     { 'F', 0, "SSI1RX", ALT2 },    { 'F', 0, "CAN0RX", ALT3 },
+    { 'F', 0, "M1PWM4", ALT5 },    { 'F', 0, "PHA0", ALT6 },      { 'F', 0, "T0CCP0", ALT7 },
+    { 'F', 0, "NMI", ALT8 },       { 'F', 0, "C0O", ALT9 },
+    { 'F', 1, "U1CTS", ALT1 },     { 'F', 1, "SSI1TX", ALT2 },    { 'F', 1, "M1PWM5", ALT5 },
+    { 'F', 1, "PHB0", ALT6 },      { 'F', 1, "T0CCP1", ALT7 },    { 'F', 1, "C1O", ALT9 },
+    { 'F', 1, "TRD1", ALT10 },
+    { 'F', 2, "SSI1CLK", ALT2 },   { 'F', 2, "M0FAULT0", ALT4 },  { 'F', 2, "M1PWM6", ALT5 },
+    { 'F', 2, "T1CCP0", ALT7 },    { 'F', 2, "TRD0", ALT10 },
+    { 'F', 3, "SSI1FSS", ALT2 },   { 'F', 3, "CAN0TX", ALT3 },    { 'F', 3, "M1PWM7", ALT5 },
+    { 'F', 3, "T1CCP1", ALT7 },    { 'F', 3, "TRCLK", ALT10 },
+    { 'F', 4, "M1FAULT0", ALT5 },  { 'F', 4, "IDX0", ALT6 },      { 'F', 4, "T2CCP0", ALT7 },
+    { 'F', 4, "USB0EPEN", ALT8 }
+};
+
+#define GEN_NUMBER_OF_SIGNALS           ((int)(sizeof(Gen_Signals) / sizeof(Gen_Signals[0])))
+
+/* Allowed modes of each pin, the same table checked by PORT_PIN_CONFIG */
+static const uint32 Gen_AllowedModes[PORT_NUMBER_OF_PORTS][PORT_NUMBER_OF_PINS_PER_PORT] =
+        PORT_ALLOWED_MODES_TABLE;
+
+/************************************************************************************/
+/* Description: Name of a mode as written in the generated header */
+static const char * Gen_ModeName(Port_PinModeType Mode)
+{
+    static const char * const names[] =
+    {
+        "GPIO_MODE", "ALT1", "ALT2", "ALT3", "ALT4", "ALT5", "ALT6", "ALT7", "ALT8", "ALT9",
+        "", "", "", "", "ALT10", "ALT11", "ANALOG"
+    };
+
+    return names[Mode];
+}
+
+/************************************************************************************/
+/* Description: Number of pins carrying the signal of an entry */
+static int Gen_SignalPins(const Gen_SignalType * Signal)
+{
+    int pins = 0;
+    int index;
+
+    for (index = 0; index < GEN_NUMBER_OF_SIGNALS; index++)
+    {
+        if (strcmp(Gen_Signals[index].signal, Signal->signal) == 0)
+        {
+            pins++;
+        }
+    }
+
+    return pins;
+}
+
+/************************************************************************************/
+/* Description: Check every entry against the allowed modes of its pin and for duplicates,
+ *              returns the number of errors */
+static int Gen_CheckSignals(void)
+{
+    const Gen_SignalType * Signal;
+    int port;
+    int errors = 0;
+    int index;
+    int other;
+
+    for (index = 0; index < GEN_NUMBER_OF_SIGNALS; index++)
+    {
+        Signal = &Gen_Signals[index];
+        port = Signal->port - 'A';
+
+        if ((port < 0) || (port >= (int)PORT_NUMBER_OF_PORTS) || (Signal->pin >= PORT_NUMBER_OF_PINS_PER_PORT)
+                || ((Gen_AllowedModes[port][Signal->pin] & PORT_MODE_BIT(Signal->mode)) == 0U))
+        {
+            fprintf(stderr, "error: %s on P%c%u: mode %s is not allowed on the pin\n",
+                    Signal->signal, Signal->port, (unsigned)Signal->pin, Gen_ModeName(Signal->mode));
+            errors++;
+        }
+
+        for (other = 0; other < index; other++)
+        {
+            if ((Gen_Signals[other].port == Signal->port) && (Gen_Signals[other].pin == Signal->pin)
+                    && ((strcmp(Gen_Signals[other].signal, Signal->signal) == 0)
+                            || ((Gen_Signals[other].mode == Signal->mode) && (Signal->mode != ANALOG))))
+            {
+                fprintf(stderr, "error: %s on P%c%u: signal or mode listed twice for the pin\n",
+                        Signal->signal, Signal->port, (unsigned)Signal->pin);
+                errors++;
+            }
+        }
+    }
+
+    return errors;
+}
+
+/************************************************************************************/
+/* Description: Write Port_PinMux.h */
+static void Gen_WritePinMux(FILE * Out)
+{
+    const Gen_SignalType * Signal;
+    char name[32];
+    int index;
+
+    fprintf(Out,
+            "/******************************************************************************" NL
+            " *" NL
+            " * Module: Port" NL
+            " *" NL
+            " * File Name: Port_PinMux.h" NL
+            " *" NL
+            " * Description: Pin-mux database for TM4C123GH6PM Microcontroller - Port Driver" NL
+            " *              GENERATED by Tools/PinMuxGen, do not edit." NL
+            " *" NL
+            " * Author: Yousouf Soliman" NL
+            " ******************************************************************************/" NL
+            NL
+            "#ifndef PORT_PINMUX_H_" NL
+            "#define PORT_PINMUX_H_" NL
+            NL
+            "/*" NL
+            " * PORT_MUX_Pxn_SIGNAL is the port letter, the pin number and the mode of a signal on" NL
+            " * the pin Pxn, the low nibble of the mode is the PMCx value written in GPIOPCTL. Used" NL
+            " * through PORT_PIN_CONFIG_MUX and PORT_MUX_MODE (Port_Types.h), e.g. PA0_U0RX." NL
+            " */" NL);
+
+    for (index = 0; index < GEN_NUMBER_OF_SIGNALS; index++)
+    {
+        Signal = &Gen_Signals[index];
+
+        if ((index != 0) && (Gen_Signals[index - 1].port != Signal->port))
+        {
+            fprintf(Out, NL);
+        }
+
+        sprintf(name, "PORT_MUX_P%c%u_%s", Signal->port, (unsigned)Signal->pin, Signal->signal);
+        fprintf(Out, "#define %-32s %c, %u, %s" NL, name, Signal->port, (unsigned)Signal->pin,
+                Gen_ModeName(Signal->mode));
+    }
+
+    fprintf(Out,
+            NL
+            "/*" NL
+            " * Signals found on one pin only, named without the pin. The signals available on" NL
+            " * several pins (e.g. CAN0RX on PB4, PE4 and PF0) need the PORT_MUX_Pxn_SIGNAL name." NL
+            " */" NL);
+
+    for (index = 0; index < GEN_NUMBER_OF_SIGNALS; index++)
+    {
+        Signal = &Gen_Signals[index];
+
+        if (Gen_SignalPins(Signal) == 1)
+        {
+            sprintf(name, "PORT_MUX_%s", Signal->signal);
+            fprintf(Out, "#define %-32s PORT_MUX_P%c%u_%s" NL, name, Signal->port, (unsigned)Signal->pin,
+                    Signal->signal);
+        }
+    }
+
+    fprintf(Out,
+            NL
+            "#endif /* PORT_PINMUX_H_ */" NL);
+}
+
+/************************************************************************************/
+int main(int argc, char * argv[])
+{
+    FILE * out;
+    int errors;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <output Port_PinMux.h>\n", argv[0]);
+        return 2;
+    }
+
+    errors = Gen_CheckSignals();
+    if (errors != 0)
+    {
+        fprintf(stderr, "%d error(s), %s not written\n", errors, argv[1]);
+        return 1;
+    }
+
+    /* Binary mode keeps the CRLF line endings as they are */
+    out = fopen(argv[1], "wb");
+    if (out == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    Gen_WritePinMux(out);
+    fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,259 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Bench.c
+ *
+ * Description: Host benchmark of the Port Driver initialization. Port.c runs
+ *              against simulated GPIO and SYSCTL registers (Port_BenchRegs.h)
+ *              that count the register accesses, and the phases of Port_Init /
+ *              Port_InitPins are timed with Port_GetInitTiming.
+ *
+ *              Port_Init stores the images generated per port, so its cost is
+ *              given by the used ports and not by the number of pins. The scaling
+ *              with the number of pins (1 to 43, the pins of Port_PinConfig in
+ *              their order) is measured through Port_InitPins, which builds the
+ *              images at run time and writes them with the same Port_ApplyImage.
+ *
+ *              Build and run on Linux from this directory:
+ *                gcc -O2 -o Port_Bench -include Port_BenchRegs.h -I. -I../../AUTOSAR_Project Port_Bench.c
+ *                    ../../AUTOSAR_Project/Port.c ../../AUTOSAR_Project/Port_PBcfg.c
+ *                    ../../AUTOSAR_Project/Port_PBimage.c ../../AUTOSAR_Project/Port_Image.c
+ *                ./Port_Bench
+ *
+ *              A register access is one expansion of PORT_GPIO or of a SYSCTL
+ *              register, so a compound assignment (|=) counts once. The host times
+ *              (ns) give the weight of each phase, not the cycles of the target.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Port.h"
+#include "Det.h"
+
+/* Number of runs of each measure, the times are averaged */
+#define BENCH_RUNS                      (2000U)
+
+/* Mixes of modes applied to the measured pins */
+#define BENCH_MIX_GPIO_IN               (0U)
+#define BENCH_MIX_GPIO_OUT              (1U)
+#define BENCH_MIX_PULL_UP               (2U)
+#define BENCH_MIX_ALTERNATE             (3U)
+#define BENCH_NUMBER_OF_MIXES           (4U)
+
+static const char * const Bench_MixName[BENCH_NUMBER_OF_MIXES] = {"gpio-in", "gpio-out", "pull-up", "alt/analog"};
+
+/* Allowed modes of each pin, the alternate mix uses the first non GPIO mode of each pin */
+static const uint32 Bench_AllowedModes[PORT_NUMBER_OF_PORTS][PORT_NUMBER_OF_PINS_PER_PORT] =
+        PORT_ALLOWED_MODES_TABLE;
+
+Port_GpioRegsType Bench_GpioBlocks[PORT_NUMBER_OF_PORTS];
+
+/* RCGCGPIO and PRGPIO share one word so the enabled ports are ready at once */
+static volatile uint32 Bench_GpioClocks;
+
+static unsigned long Bench_RegAccesses;
+static unsigned long Bench_DetErrors;
+
+/************************************************************************************/
+/* Description: Simulated GPIO register of a port, in Bench_GpioBlocks */
+volatile uint32 * Bench_GpioReg(volatile uint32 *Reg)
+{
+    Bench_RegAccesses++;
+    return Reg;
+}
+
+/************************************************************************************/
+/* Description: Simulated RCGCGPIO/PRGPIO register */
+volatile uint32 * Bench_SysctlReg(uint32 Offset)
+{
+    (void)Offset;
+    Bench_RegAccesses++;
+    return &Bench_GpioClocks;
+}
+
+/************************************************************************************/
+/* Description: Host time in ns, only the differences are used so the wrap is harmless */
+uint32 Bench_Now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32)((unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec);
+}
+
+/************************************************************************************/
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    (void)ApiId;
+    (void)ErrorId;
+    Bench_DetErrors++;
+    return E_OK;
+}
+
+/************************************************************************************/
+/* Description: Registers after reset, all the ports gated */
+static void Bench_Reset(void)
+{
+    memset((void *)Bench_GpioBlocks, 0, sizeof(Bench_GpioBlocks));
+    Bench_GpioClocks = 0;
+    Bench_RegAccesses = 0;
+}
+
+/************************************************************************************/
+/* Description: First NumberOfPins pins of Port_PinConfig with the modes of a mix */
+static void Bench_BuildPins(Port_ConfigPin * Pins, uint8 NumberOfPins, uint8 Mix)
+{
+    uint32 allowed;
+    uint32 mode;
+    uint8 index;
+
+    for (index = 0; index < NumberOfPins; index++)
+    {
+        Pins[index] = Port_PinConfig.Pin[index];
+        Pins[index].mode = GPIO_MODE;
+        Pins[index].direction = PORT_PIN_IN;
+        Pins[index].resistor = OFF;
+        Pins[index].initial_value = PORT_PIN_LEVEL_LOW;
+
+        if (Mix == BENCH_MIX_GPIO_OUT)
+        {
+            Pins[index].direction = PORT_PIN_OUT;
+            Pins[index].initial_value = PORT_PIN_LEVEL_HIGH;
+        }
+        else if (Mix == BENCH_MIX_PULL_UP)
+        {
+            Pins[index].resistor = PULL_UP;
+        }
+        else if (Mix == BENCH_MIX_ALTERNATE)
+        {
+            allowed = Bench_AllowedModes[Pins[index].port_num][Pins[index].pin_num] & ~PORT_MODE_BIT(GPIO_MODE);
+            for (mode = (uint32)ALT1; mode <= (uint32)ANALOG; mode++)
+            {
+                if ((allowed & PORT_MODE_BIT(mode)) != 0U)
+                {
+                    Pins[index].mode = mode;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            /* GPIO inputs */
+        }
+    }
+}
+
+/************************************************************************************/
+/* Description: Print the accesses, the time of a call and of each phase averaged over the runs */
+static void Bench_Print(const char * Name, unsigned NumberOfPins, unsigned long Accesses,
+                        unsigned long long TotalNs, const unsigned long long * PhaseNs)
+{
+    double call_ns = (double)TotalNs / BENCH_RUNS;
+    uint8 phase;
+
+    printf("%-24s %3u %5lu %9.1f %8.1f", Name, NumberOfPins, Accesses, call_ns,
+           (NumberOfPins != 0U) ? call_ns / NumberOfPins : 0.0);
+    for (phase = 0; phase < PORT_INIT_NUMBER_OF_PHASES; phase++)
+    {
+        printf(" %8.1f", (double)PhaseNs[phase] / BENCH_RUNS);
+    }
+    printf("\n");
+}
+
+/************************************************************************************/
+int main(void)
+{
+    static Port_ConfigPin Pins[PORT_NUMBER_OF_PORT_PINS];
+    unsigned long long phase_ns[PORT_INIT_NUMBER_OF_PHASES];
+    uint32 phase_cycles[PORT_INIT_NUMBER_OF_PHASES];
+    unsigned long long total_ns;
+    unsigned long accesses;
+    unsigned long continue_accesses;
+    char name[32];
+    uint32 start;
+    unsigned run;
+    uint8 number_of_pins;
+    uint8 mix;
+    uint8 phase;
+    uint8 set;
+
+    printf("%-24s %3s %5s %9s %8s %8s %8s %8s %8s %8s\n", "measure", "pins", "regs", "ns/call", "ns/pin",
+           "clock", "unlock", "mode", "pulls", "dir");
+
+    /* Port_Init of each configuration set, the deferred pins are finished by Port_InitContinue */
+    for (set = 0; set < PORT_NUMBER_OF_CONFIG_SETS; set++)
+    {
+        memset(phase_ns, 0, sizeof(phase_ns));
+        total_ns = 0;
+        accesses = 0;
+        continue_accesses = 0;
+
+        for (run = 0; run < BENCH_RUNS; run++)
+        {
+            Bench_Reset();
+            start = Bench_Now();
+            Port_Init(Port_ConfigSets[set]);
+            total_ns += (uint32)(Bench_Now() - start);
+            accesses = Bench_RegAccesses;
+
+            Port_GetInitTiming(phase_cycles);
+            for (phase = 0; phase < PORT_INIT_NUMBER_OF_PHASES; phase++)
+            {
+                phase_ns[phase] += phase_cycles[phase];
+            }
+
+            Bench_RegAccesses = 0;
+            while (Port_InitContinue() == FALSE)
+            {
+            }
+            continue_accesses = Bench_RegAccesses;
+        }
+
+        sprintf(name, "Port_Init set %u", (unsigned)set);
+        Bench_Print(name, PORT_NUMBER_OF_PORT_PINS, accesses, total_ns, phase_ns);
+        printf("%-24s %3s %5lu\n", "  + Port_InitContinue", "", continue_accesses);
+    }
+
+    /* Port_InitPins with 1 to 43 pins for each mix of modes */
+    for (mix = 0; mix < BENCH_NUMBER_OF_MIXES; mix++)
+    {
+        for (number_of_pins = 1; number_of_pins <= PORT_NUMBER_OF_PORT_PINS; number_of_pins++)
+        {
+            Bench_BuildPins(Pins, number_of_pins, mix);
+            memset(phase_ns, 0, sizeof(phase_ns));
+            total_ns = 0;
+            accesses = 0;
+
+            for (run = 0; run < BENCH_RUNS; run++)
+            {
+                Bench_Reset();
+                start = Bench_Now();
+                Port_InitPins(Pins, number_of_pins);
+                total_ns += (uint32)(Bench_Now() - start);
+                accesses = Bench_RegAccesses;
+
+                Port_GetInitTiming(phase_cycles);
+                for (phase = 0; phase < PORT_INIT_NUMBER_OF_PHASES; phase++)
+                {
+                    phase_ns[phase] += phase_cycles[phase];
+                }
+            }
+
+            sprintf(name, "Port_InitPins %s", Bench_MixName[mix]);
+            Bench_Print(name, number_of_pins, accesses, total_ns, phase_ns);
+        }
+    }
+
+    if (Bench_DetErrors != 0U)
+    {
+        printf("%lu Det error(s) reported\n", Bench_DetErrors);
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_BenchRegs.h
+ *
+ * Description: Forced include (-include) of the Port benchmark, redirects the
+ *              registers of the Port Driver to simulated registers counting the
+ *              accesses and enables the phases timing with a host time source.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef PORT_BENCH_REGS_H
+#define PORT_BENCH_REGS_H
+
+#include "Std_Types.h"
+
+/* Simulated registers, each call is one register access */
+extern volatile uint32 * Bench_GpioReg(volatile uint32 *Reg);
+extern volatile uint32 * Bench_SysctlReg(uint32 Offset);
+
+/* Host time in ns */
+extern uint32 Bench_Now(void);
+
+/* The blocks of the ports are simulated, the base addresses select them (constant expressions
+ * for the tables of Port.c) and each register of a block goes through Bench_GpioReg */
+#define PORT_GPIO_BLOCK(BASE)           (&Bench_GpioBlocks[((BASE) >= GPIO_PORTE_BASE_ADDRESS) \
+                                                ? 4U + (((BASE) - GPIO_PORTE_BASE_ADDRESS) >> 12) \
+                                                : ((BASE) - GPIO_PORTA_BASE_ADDRESS) >> 12])
+#define PORT_GPIO(GPIO, REG)            (*Bench_GpioReg(&(GPIO)->REG))
+#define SYSCTL_RCGCGPIO_REG             (*Bench_SysctlReg(0x608U))
+#define SYSCTL_PRGPIO_REG               (*Bench_SysctlReg(0xA08U))
+
+#include "Port_Reg.h"
+
+extern Port_GpioRegsType Bench_GpioBlocks[];
+
+#define PORT_INIT_TIMING                (STD_ON)
+#define PORT_TIMING_ENABLE()
+#define PORT_TIMING_NOW()               Bench_Now()
+
+#endif /* PORT_BENCH_REGS_H */
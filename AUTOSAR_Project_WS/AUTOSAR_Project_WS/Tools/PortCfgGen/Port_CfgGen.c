@@ -0,0 +1,357 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_CfgGen.c
+ *
+ * Description: Host tool generating the registers images of the Port Driver.
+ *              Validates every configuration set of Port_ConfigSets (Port_PBcfg.c)
+ *              and writes Port_PBimage.c with one ready to write image per port
+ *              and set, including the PD7/PF0 commit bits and the pad control
+ *              (drive, slew rate, open drain), so Port_Init only stores the
+ *              images. The pins of each profile get their own images
+ *              used by Port_ApplyProfile and the park states of the pins give the
+ *              masks used by Port_EnterLowPower. The critical pins get a second
+ *              image written by Port_Init, the rest by Port_InitContinue.
+ *              Each pin also gets a descriptor (base address, bit, PCTL shift,
+ *              allowed modes) used by Port_SetPinDirection and Port_SetPinMode.
+ *              The images are encoded by Port_AddPinToImage (Port_Image.c), the
+ *              same function Port_InitPins uses at run time.
+ *
+ *              Build and run on Linux from this directory after changing Port_PBcfg.c:
+ *                gcc -o Port_CfgGen -I../../AUTOSAR_Project Port_CfgGen.c ../../AUTOSAR_Project/Port_PBcfg.c
+ *                    ../../AUTOSAR_Project/Port_Image.c
+ *                ./Port_CfgGen ../../AUTOSAR_Project/Port_PBimage.c
+ *
+ *              Exits with 1 and writes nothing when the configuration is invalid.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "Port.h"
+
+/* The generated files use the line endings of the project */
+#define NL "\r\n"
+
+/* Pins of each port, PORTE has 6 pins and PORTF has 5 pins */
+static const uint8 Gen_PortPinsMask[PORT_NUMBER_OF_PORTS] = {0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F};
+
+/* Allowed modes of each pin, the same table used by Port_SetPinMode */
+static const uint32 Gen_AllowedModes[PORT_NUMBER_OF_PORTS][PORT_NUMBER_OF_PINS_PER_PORT] =
+        PORT_ALLOWED_MODES_TABLE;
+
+static const char Gen_PortName[PORT_NUMBER_OF_PORTS] = {'A', 'B', 'C', 'D', 'E', 'F'};
+
+static const uint32 Gen_PortBase[PORT_NUMBER_OF_PORTS] =
+{
+    GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Port_PBcfg.c refers to the generated images, the tool only needs the symbols to link */
+const Port_RegImageType Port_ConfigSetImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+const Port_RegImageType Port_ConfigSetProfileImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PROFILES][PORT_NUMBER_OF_PORTS];
+const Port_ParkImageType Port_ConfigSetParking[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+const Port_RegImageType Port_ConfigSetCriticalImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+const Port_PinDescType Port_ConfigSetPinDesc[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORT_PINS];
+
+/************************************************************************************/
+/* Description: Set the bit of a configured pin in the low power masks of its port */
+static void Gen_AddPinToParking(const Port_ConfigPin * Pin, Port_ParkImageType * Parking)
+{
+    uint8 bit = (uint8)(1U << Pin->pin_num);
+
+    if (Pin->park == PORT_PIN_PARK_ANALOG)
+    {
+        Parking->analog |= bit;
+    }
+    else if (Pin->park == PORT_PIN_PARK_PULL_DOWN)
+    {
+        Parking->pull_down |= bit;
+    }
+    else if (Pin->park == PORT_PIN_PARK_PULL_UP)
+    {
+        Parking->pull_up |= bit;
+    }
+    else
+    {
+        /* Live pin */
+    }
+}
+
+/************************************************************************************/
+/* Description: Check every pin of a pins list and build the images (and the low power masks
+ *              and critical pins images when Parking and CriticalImages are not NULL),
+ *              returns the number of errors */
+static int Gen_BuildImages(const char * Name, const Port_ConfigPin * Pins, int NumberOfPins,
+                           Port_RegImageType * Images, Port_ParkImageType * Parking,
+                           Port_RegImageType * CriticalImages)
+{
+    const Port_ConfigPin * Pin;
+    int errors = 0;
+    int index;
+
+    for (index = 0; index < NumberOfPins; index++)
+    {
+        Pin = &Pins[index];
+
+        /* The bit-fields widths of Port_ConfigPin already bound the pin number, direction and park state */
+        if ((Pin->port_num >= PORT_NUMBER_OF_PORTS)
+                || ((Gen_PortPinsMask[Pin->port_num] & (1U << Pin->pin_num)) == 0U))
+        {
+            fprintf(stderr, "error: %s[%d]: port %u pin %u does not exist\n",
+                    Name, index, (unsigned)Pin->port_num, (unsigned)Pin->pin_num);
+            errors++;
+        }
+        else if (PORT_PIN_IS_RESERVED(Pin->port_num, Pin->pin_num))
+        {
+            /* The JTAG pins (and PD7/PF0 when not unlocked) are never configured,
+             * PORT_PIN_CONFIG already checked they are listed as reserved */
+        }
+        else if ((Images[Pin->port_num].mask & (1U << Pin->pin_num)) != 0U)
+        {
+            fprintf(stderr, "error: %s[%d]: P%c%u is configured twice\n",
+                    Name, index, Gen_PortName[Pin->port_num], (unsigned)Pin->pin_num);
+            errors++;
+        }
+        else if (((uint32)Pin->mode > (uint32)ANALOG)
+                || ((Gen_AllowedModes[Pin->port_num][Pin->pin_num] & PORT_MODE_BIT(Pin->mode)) == 0U))
+        {
+            fprintf(stderr, "error: %s[%d]: mode %u is not allowed on P%c%u\n",
+                    Name, index, (unsigned)Pin->mode, Gen_PortName[Pin->port_num], (unsigned)Pin->pin_num);
+            errors++;
+        }
+        else if ((Pin->resistor > (uint32)PULL_DOWN)
+                || ((Pin->park == PORT_PIN_PARK_ANALOG)
+                        && ((Gen_AllowedModes[Pin->port_num][Pin->pin_num] & PORT_MODE_BIT(ANALOG)) == 0U)))
+        {
+            fprintf(stderr, "error: %s[%d]: resistor %u or park state %u is not possible on P%c%u\n",
+                    Name, index, (unsigned)Pin->resistor, (unsigned)Pin->park,
+                    Gen_PortName[Pin->port_num], (unsigned)Pin->pin_num);
+            errors++;
+        }
+        else
+        {
+            Port_AddPinToImage(Pin, &Images[Pin->port_num]);
+
+            if (Parking != NULL)
+            {
+                Gen_AddPinToParking(Pin, &Parking[Pin->port_num]);
+            }
+
+            if ((CriticalImages != NULL) && (Pin->init_class == PORT_PIN_INIT_CRITICAL))
+            {
+                Port_AddPinToImage(Pin, &CriticalImages[Pin->port_num]);
+            }
+        }
+    }
+
+    return errors;
+}
+
+/************************************************************************************/
+/* Description: Write the initializer of the images of the ports with the given indentation */
+static void Gen_WritePortImages(FILE * Out, const Port_RegImageType * Images, const char * Indent)
+{
+    int port;
+
+    for (port = 0; port < (int)PORT_NUMBER_OF_PORTS; port++)
+    {
+        fprintf(Out,
+                "%s/* PORT%c */" NL
+                "%s{ 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X,"
+                " 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%08lXU }%s" NL,
+                Indent, Gen_PortName[port], Indent,
+                Images[port].mask, Images[port].dir, Images[port].data, Images[port].den,
+                Images[port].afsel, Images[port].amsel, Images[port].pur, Images[port].pdr,
+                Images[port].commit, Images[port].dir_refresh,
+                Images[port].dr2r, Images[port].dr4r, Images[port].dr8r, Images[port].slr, Images[port].odr,
+                (unsigned long)Images[port].pctl,
+                (port < ((int)PORT_NUMBER_OF_PORTS - 1)) ? "," : "");
+    }
+}
+
+/************************************************************************************/
+/* Description: Write Port_PBimage.c */
+static void Gen_WriteImages(FILE * Out, const Port_RegImageType (*Images)[PORT_NUMBER_OF_PORTS],
+                            const Port_RegImageType (*ProfileImages)[PORT_NUMBER_OF_PROFILES][PORT_NUMBER_OF_PORTS],
+                            const Port_ParkImageType (*Parking)[PORT_NUMBER_OF_PORTS],
+                            const Port_RegImageType (*CriticalImages)[PORT_NUMBER_OF_PORTS])
+{
+    int set;
+    int profile;
+    int port;
+
+    fprintf(Out,
+            "/******************************************************************************" NL
+            " *" NL
+            " * Module: Port" NL
+            " *" NL
+            " * File Name: Port_PBimage.c" NL
+            " *" NL
+            " * Description: Registers images of the configuration sets for TM4C123GH6PM Microcontroller - Port Driver" NL
+            " *              GENERATED by Tools/PortCfgGen from Port_PBcfg.c, do not edit." NL
+            " *" NL
+            " * Author: Yousouf Soliman" NL
+            " ******************************************************************************/" NL
+            NL
+            "#include \"Port.h\"" NL
+            NL
+            "/* mask, dir, data, den, afsel, amsel, pur, pdr, commit, dir_refresh, dr2r, dr4r, dr8r, slr, odr, pctl */" NL
+            "const Port_RegImageType Port_ConfigSetImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS] =" NL
+            "{" NL);
+    for (set = 0; set < (int)PORT_NUMBER_OF_CONFIG_SETS; set++)
+    {
+        fprintf(Out, "    /* Configuration set %d */" NL "    {" NL, set);
+        Gen_WritePortImages(Out, Images[set], "        ");
+        fprintf(Out, "    }%s" NL, (set < ((int)PORT_NUMBER_OF_CONFIG_SETS - 1)) ? "," : "");
+    }
+    fprintf(Out, "};" NL);
+
+    fprintf(Out,
+            NL
+            "/* Pins of each profile only, the mask selects the pins switched by Port_ApplyProfile */" NL
+            "const Port_RegImageType Port_ConfigSetProfileImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PROFILES][PORT_NUMBER_OF_PORTS] =" NL
+            "{" NL);
+    for (set = 0; set < (int)PORT_NUMBER_OF_CONFIG_SETS; set++)
+    {
+        fprintf(Out, "    /* Configuration set %d */" NL "    {" NL, set);
+        for (profile = 0; profile < (int)PORT_NUMBER_OF_PROFILES; profile++)
+        {
+            fprintf(Out, "        /* Profile %d */" NL "        {" NL, profile);
+            Gen_WritePortImages(Out, ProfileImages[set][profile], "            ");
+            fprintf(Out, "        }%s" NL, (profile < ((int)PORT_NUMBER_OF_PROFILES - 1)) ? "," : "");
+        }
+        fprintf(Out, "    }%s" NL, (set < ((int)PORT_NUMBER_OF_CONFIG_SETS - 1)) ? "," : "");
+    }
+    fprintf(Out, "};" NL);
+
+    fprintf(Out,
+            NL
+            "/* analog, pull_down, pull_up */" NL
+            "const Port_ParkImageType Port_ConfigSetParking[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS] =" NL
+            "{" NL);
+    for (set = 0; set < (int)PORT_NUMBER_OF_CONFIG_SETS; set++)
+    {
+        fprintf(Out, "    /* Configuration set %d */" NL "    {" NL, set);
+        for (port = 0; port < (int)PORT_NUMBER_OF_PORTS; port++)
+        {
+            fprintf(Out, "        { 0x%02X, 0x%02X, 0x%02X }%s /* PORT%c */" NL,
+                    Parking[set][port].analog, Parking[set][port].pull_down, Parking[set][port].pull_up,
+                    (port < ((int)PORT_NUMBER_OF_PORTS - 1)) ? "," : " ", Gen_PortName[port]);
+        }
+        fprintf(Out, "    }%s" NL, (set < ((int)PORT_NUMBER_OF_CONFIG_SETS - 1)) ? "," : "");
+    }
+    fprintf(Out, "};" NL);
+
+    fprintf(Out,
+            NL
+            "/* PORT_PIN_INIT_CRITICAL pins only, written by Port_Init */" NL
+            "const Port_RegImageType Port_ConfigSetCriticalImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS] =" NL
+            "{" NL);
+    for (set = 0; set < (int)PORT_NUMBER_OF_CONFIG_SETS; set++)
+    {
+        fprintf(Out, "    /* Configuration set %d */" NL "    {" NL, set);
+        Gen_WritePortImages(Out, CriticalImages[set], "        ");
+        fprintf(Out, "    }%s" NL, (set < ((int)PORT_NUMBER_OF_CONFIG_SETS - 1)) ? "," : "");
+    }
+    fprintf(Out, "};" NL);
+}
+
+/************************************************************************************/
+/* Description: Write the descriptors of the pins of every configuration set, the
+ *              reserved pins get no allowed mode so the runtime APIs skip them */
+static void Gen_WritePinDesc(FILE * Out)
+{
+    const Port_ConfigPin * Pin;
+    uint32 allowed;
+    uint8 bit;
+    int set;
+    int index;
+
+    fprintf(Out,
+            NL
+            "/* base, allowed_modes, port_num, bit, pctl_shift, commit */" NL
+            "const Port_PinDescType Port_ConfigSetPinDesc[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORT_PINS] =" NL
+            "{" NL);
+    for (set = 0; set < (int)PORT_NUMBER_OF_CONFIG_SETS; set++)
+    {
+        fprintf(Out, "    /* Configuration set %d */" NL "    {" NL, set);
+        for (index = 0; index < (int)PORT_NUMBER_OF_PORT_PINS; index++)
+        {
+            Pin = &Port_ConfigSets[set]->Pin[index];
+            bit = (uint8)(1U << Pin->pin_num);
+            allowed = PORT_PIN_IS_RESERVED(Pin->port_num, Pin->pin_num)
+                    ? 0U : Gen_AllowedModes[Pin->port_num][Pin->pin_num];
+
+            fprintf(Out, "        { 0x%08XU, 0x%05XU, %u, 0x%02X, %2u, 0x%02X }%s /* %2d P%c%u */" NL,
+                    (unsigned)Gen_PortBase[Pin->port_num], (unsigned)allowed, (unsigned)Pin->port_num,
+                    bit, (unsigned)Pin->pin_num * 4U,
+                    PORT_PIN_IS_LOCKED(Pin->port_num, Pin->pin_num) ? bit : 0U,
+                    (index < ((int)PORT_NUMBER_OF_PORT_PINS - 1)) ? "," : " ",
+                    index, Gen_PortName[Pin->port_num], (unsigned)Pin->pin_num);
+        }
+        fprintf(Out, "    }%s" NL, (set < ((int)PORT_NUMBER_OF_CONFIG_SETS - 1)) ? "," : "");
+    }
+    fprintf(Out, "};" NL);
+}
+
+/************************************************************************************/
+int main(int argc, char * argv[])
+{
+    static Port_RegImageType Images[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+    static Port_RegImageType ProfileImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PROFILES][PORT_NUMBER_OF_PORTS];
+    static Port_ParkImageType Parking[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+    static Port_RegImageType CriticalImages[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_PORTS];
+    const Port_ConfigType * Config;
+    char name[32];
+    FILE * out;
+    int errors = 0;
+    int set;
+    int profile;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <output Port_PBimage.c>\n", argv[0]);
+        return 2;
+    }
+
+    for (set = 0; set < (int)PORT_NUMBER_OF_CONFIG_SETS; set++)
+    {
+        Config = Port_ConfigSets[set];
+
+        sprintf(name, "Set%d.Pin", set);
+        errors += Gen_BuildImages(name, Config->Pin, (int)PORT_NUMBER_OF_PORT_PINS, Images[set], Parking[set],
+                                  CriticalImages[set]);
+
+        for (profile = 0; profile < (int)PORT_NUMBER_OF_PROFILES; profile++)
+        {
+            sprintf(name, "Set%d.Profile%d", set, profile);
+            errors += Gen_BuildImages(name, Config->Profiles[profile].Pins,
+                                      (int)Config->Profiles[profile].NumberOfPins, ProfileImages[set][profile], NULL, NULL);
+        }
+    }
+
+    if (errors != 0)
+    {
+        fprintf(stderr, "%d error(s), %s not written\n", errors, argv[1]);
+        return 1;
+    }
+
+    /* Binary mode keeps the CRLF line endings as they are */
+    out = fopen(argv[1], "wb");
+    if (out == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    Gen_WriteImages(out, (const Port_RegImageType (*)[PORT_NUMBER_OF_PORTS])Images,
+                    (const Port_RegImageType (*)[PORT_NUMBER_OF_PROFILES][PORT_NUMBER_OF_PORTS])ProfileImages,
+                    (const Port_ParkImageType (*)[PORT_NUMBER_OF_PORTS])Parking,
+                    (const Port_RegImageType (*)[PORT_NUMBER_OF_PORTS])CriticalImages);
+    Gen_WritePinDesc(out);
+    fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,284 @@
+/******************************************************************************
+ *
+ * Module: Qdec
+ *
+ * File Name: Qdec_Bench.c
+ *
+ * Description: Host benchmark of the Software Quadrature Decoder. Qdec.c runs
+ *              against simulated GPIO register blocks (Qdec_BenchRegs.h) that
+ *              count the register accesses, the encoder phases are driven by
+ *              writing the encoder state to the simulated GPIODATA of the port.
+ *
+ *              The benchmark first checks the decoding (forward and backward
+ *              steps, missed edges), then measures Qdec_EdgeHandler (one call
+ *              per edge) and Qdec_Update (polling) with a new edge before each
+ *              call. The ns per call give the maximum edge rate of the host,
+ *              the instructions per call (Linux perf hardware counter) and the
+ *              register (MMIO) accesses per call compare revisions.
+ *
+ *              The vector table and the NVIC are not simulated, build with the
+ *              edge interrupt disabled and run on Linux from this directory:
+ *                gcc -O2 -o Qdec_Bench -include Qdec_BenchRegs.h -DQDEC_EDGE_INTERRUPT=STD_OFF
+ *                    -I. -I../../AUTOSAR_Project Qdec_Bench.c ../../AUTOSAR_Project/Qdec.c
+ *                    ../../AUTOSAR_Project/Dio_PBcfg.c
+ *                ./Qdec_Bench
+ *
+ *              A register access is one expansion of PORT_GPIO. The instructions
+ *              per call exclude the benchmark loop and the access counter, both
+ *              measured separately and subtracted; they are "-" when the perf
+ *              counters are not available (e.g. perf_event_paranoid, containers).
+ *              The host figures are not the cycles of the target.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "Qdec.h"
+#include "Dio_Regs.h"
+
+/* Number of calls of each measure */
+#define BENCH_CALLS                     (5000000UL)
+
+/* Number of steps of the decoding checks */
+#define BENCH_CHECK_STEPS               (1000)
+
+typedef void (*Bench_CallType)(uint32 Index);
+
+typedef struct
+{
+    double ns_per_call;
+    double instructions;            /* Instructions of the measure, negative when not counted */
+    unsigned long accesses;
+} Bench_ResultType;
+
+Port_GpioRegsType Bench_GpioBlocks[DIO_NUMBER_OF_PORTS];
+
+static unsigned long Bench_RegAccesses;
+
+/* Encoder states (B << 1) | A of the forward sequence */
+static const uint8 Bench_Sequence[4] = {0U, 1U, 3U, 2U};
+
+/* Simulated GPIODATA of the phase pins, set by Bench_Init */
+static volatile uint32 * Bench_PhaseData;
+static uint8 Bench_PhaseA_Pin;
+static uint8 Bench_PhaseB_Pin;
+
+/* Register used to measure the cost of the access counter */
+static volatile uint32 Bench_CounterReg;
+
+/* File descriptor of the instructions counter, -1 when not available */
+static int Bench_PerfFd = -1;
+
+/************************************************************************************/
+/* Description: Simulated GPIO register of a port, in Bench_GpioBlocks */
+volatile uint32 * Bench_GpioReg(volatile uint32 *Reg)
+{
+    Bench_RegAccesses++;
+    return Reg;
+}
+
+/************************************************************************************/
+/* Description: Drive the phase pins with the encoder state of a step of the forward sequence */
+static void Bench_SetStep(uint32 Step)
+{
+    uint8 state = Bench_Sequence[Step & 0x03U];
+
+    *Bench_PhaseData = ((uint32)(state & 0x01U) << Bench_PhaseA_Pin)
+            | ((uint32)(state >> 1) << Bench_PhaseB_Pin);
+}
+
+/************************************************************************************/
+/* Description: Initialize the decoder on the simulated port, encoder at step 0 */
+static void Bench_Init(void)
+{
+    const Dio_ConfigChannel * PhaseA = &Dio_Configuration.Channels[QDEC_PHASE_A_CHANNEL_ID_INDEX];
+    const Dio_ConfigChannel * PhaseB = &Dio_Configuration.Channels[QDEC_PHASE_B_CHANNEL_ID_INDEX];
+
+    memset((void *)Bench_GpioBlocks, 0, sizeof(Bench_GpioBlocks));
+    Bench_PhaseA_Pin = PhaseA->Ch_Num;
+    Bench_PhaseB_Pin = PhaseB->Ch_Num;
+    Bench_PhaseData = &Bench_GpioBlocks[PhaseA->Port_Num].DATA[((uint32)1U << Bench_PhaseA_Pin)
+            | ((uint32)1U << Bench_PhaseB_Pin)];
+
+    Bench_SetStep(0U);
+    Qdec_Init();
+}
+
+/************************************************************************************/
+/* Description: Measured calls, each one after the edge to the next step of the sequence */
+static __attribute__((noinline)) void Bench_EdgeHandler(uint32 Index)
+{
+    Bench_SetStep(Index + 1U);
+    Qdec_EdgeHandler();
+}
+
+static __attribute__((noinline)) void Bench_Update(uint32 Index)
+{
+    Bench_SetStep(Index + 1U);
+    Qdec_Update();
+}
+
+/* Description: Same edge without the call (loop cost) */
+static __attribute__((noinline)) void Bench_Nothing(uint32 Index)
+{
+    Bench_SetStep(Index + 1U);
+}
+
+/* Description: One access through the counter (cost of the counter, subtracted per access) */
+static __attribute__((noinline)) void Bench_Counter(uint32 Index)
+{
+    Bench_SetStep(Index + 1U);
+    *Bench_GpioReg(&Bench_CounterReg) = Index;
+}
+
+/************************************************************************************/
+/* Description: Check the position and the error count after Steps edges of Stride steps */
+static int Bench_Check(const char * Name, sint32 Steps, sint32 Stride,
+        sint32 ExpectedPosition, uint32 ExpectedErrors)
+{
+    sint32 step;
+    uint32 state = 0U;
+    int passed;
+
+    Bench_Init();
+    for (step = 0; step < Steps; step++)
+    {
+        state = (uint32)((sint32)state + Stride);
+        Bench_SetStep(state);
+        Qdec_EdgeHandler();
+    }
+
+    passed = (Qdec_GetPosition() == ExpectedPosition) && (Qdec_GetErrorCount() == ExpectedErrors);
+    printf("%-28s position %6ld (expected %6ld) errors %5lu (expected %5lu) %s\n", Name,
+            (long)Qdec_GetPosition(), (long)ExpectedPosition, (unsigned long)Qdec_GetErrorCount(),
+            (unsigned long)ExpectedErrors, passed ? "ok" : "FAILED");
+
+    return passed;
+}
+
+/************************************************************************************/
+/* Description: Open the user space instructions counter of this thread */
+static int Bench_PerfOpen(void)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/************************************************************************************/
+/* Description: Host time in ns */
+static unsigned long long Bench_Now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+/************************************************************************************/
+/* Description: Call a function BENCH_CALLS times, counting time, instructions and accesses */
+static void Bench_Measure(Bench_CallType Call, Bench_ResultType * Result)
+{
+    unsigned long long start;
+    unsigned long long elapsed;
+    long long instructions = 0;
+    uint32 index;
+
+    Bench_Init();
+    Bench_RegAccesses = 0;
+
+    if (Bench_PerfFd >= 0)
+    {
+        ioctl(Bench_PerfFd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(Bench_PerfFd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    start = Bench_Now();
+    for (index = 0; index < BENCH_CALLS; index++)
+    {
+        Call(index);
+    }
+    elapsed = Bench_Now() - start;
+
+    if (Bench_PerfFd >= 0)
+    {
+        ioctl(Bench_PerfFd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(Bench_PerfFd, &instructions, sizeof(instructions)) != (ssize_t)sizeof(instructions))
+        {
+            instructions = -1;
+        }
+    }
+    else
+    {
+        instructions = -1;
+    }
+
+    Result->ns_per_call = (double)elapsed / BENCH_CALLS;
+    Result->instructions = (instructions >= 0) ? (double)instructions / BENCH_CALLS : -1.0;
+    Result->accesses = Bench_RegAccesses;
+}
+
+/************************************************************************************/
+/* Description: Print one measure, loop and counter costs removed */
+static void Bench_Print(const char * Name, const Bench_ResultType * Result,
+        const Bench_ResultType * Loop, const Bench_ResultType * Counter)
+{
+    double mmio_per_call = (double)Result->accesses / BENCH_CALLS;
+    double ns_per_call = Result->ns_per_call - Loop->ns_per_call;
+
+    printf("%-28s %8.1f %14.0f", Name, ns_per_call, (ns_per_call > 0.0) ? 1e9 / ns_per_call : 0.0);
+    if ((Result->instructions >= 0.0) && (Loop->instructions >= 0.0))
+    {
+        printf(" %10.1f", Result->instructions - Loop->instructions
+                - mmio_per_call * (Counter->instructions - Loop->instructions));
+    }
+    else
+    {
+        printf(" %10s", "-");
+    }
+    printf(" %8.2f\n", mmio_per_call);
+}
+
+/************************************************************************************/
+int main(void)
+{
+    Bench_ResultType loop;
+    Bench_ResultType counter;
+    Bench_ResultType result;
+    int passed = 1;
+
+    /* Decoding: one count per edge; when the edges come faster than the handler one skipped
+     * state is counted as an error and two skipped states alias to a step in the other direction */
+    passed &= Bench_Check("forward", BENCH_CHECK_STEPS, 1, BENCH_CHECK_STEPS, 0U);
+    passed &= Bench_Check("backward", BENCH_CHECK_STEPS, -1, -BENCH_CHECK_STEPS, 0U);
+    passed &= Bench_Check("missed edge (2 steps/call)", BENCH_CHECK_STEPS, 2, 0, (uint32)BENCH_CHECK_STEPS);
+    passed &= Bench_Check("aliased (3 steps/call)", BENCH_CHECK_STEPS, 3, -BENCH_CHECK_STEPS, 0U);
+    printf("\n");
+
+    Bench_PerfFd = Bench_PerfOpen();
+    Bench_Measure(Bench_Nothing, &loop);
+    Bench_Measure(Bench_Counter, &counter);
+
+    printf("%-28s %8s %14s %10s %8s\n", "measure", "ns/call", "max edges/s", "instr/call", "regs");
+
+    Bench_Measure(Bench_EdgeHandler, &result);
+    Bench_Print("Qdec_EdgeHandler", &result, &loop, &counter);
+    Bench_Measure(Bench_Update, &result);
+    Bench_Print("Qdec_Update", &result, &loop, &counter);
+
+    return passed ? 0 : 1;
+}
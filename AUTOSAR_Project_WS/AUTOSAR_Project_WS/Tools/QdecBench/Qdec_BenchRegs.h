@@ -0,0 +1,33 @@
+/******************************************************************************
+ *
+ * Module: Qdec
+ *
+ * File Name: Qdec_BenchRegs.h
+ *
+ * Description: Forced include (-include) of the Qdec benchmark, redirects the
+ *              GPIO register blocks of the Quadrature Decoder to simulated blocks
+ *              and counts the register accesses.
+ *
+ * Author: Yousouf Soliman
+ ******************************************************************************/
+
+#ifndef QDEC_BENCH_REGS_H
+#define QDEC_BENCH_REGS_H
+
+#include "Std_Types.h"
+
+/* Simulated registers, each call is one register access */
+extern volatile uint32 * Bench_GpioReg(volatile uint32 *Reg);
+
+/* The blocks of the ports are simulated, the base addresses select them (constant expressions
+ * for the table of Qdec.c) and each register of a block goes through Bench_GpioReg */
+#define PORT_GPIO_BLOCK(BASE)           (&Bench_GpioBlocks[((BASE) >= GPIO_PORTE_BASE_ADDRESS) \
+                                                ? 4U + (((BASE) - GPIO_PORTE_BASE_ADDRESS) >> 12) \
+                                                : ((BASE) - GPIO_PORTA_BASE_ADDRESS) >> 12])
+#define PORT_GPIO(GPIO, REG)            (*Bench_GpioReg(&(GPIO)->REG))
+
+#include "Port_Reg.h"
+
+extern Port_GpioRegsType Bench_GpioBlocks[];
+
+#endif /* QDEC_BENCH_REGS_H */